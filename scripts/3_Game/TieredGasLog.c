@@ -0,0 +1,143 @@
+//---------------------------------------------------------------------------------------------------
+// scripts/3_Game/TieredGasLog.c
+//
+// File summary: Leveled, rate-limited logging for TieredGas. Level and rate limit come from
+//               $profile:TieredGas/LogSettings.json. The default level (INFO) keeps DEBUG/TRACE call
+//               sites (per-tick, per-chunk, per-frame) silent.
+//
+//               Hot paths must guard with IsEnabled() before building the message, otherwise the string
+//               concatenation still runs even though nothing is printed.
+//
+// TieredGasLog
+//
+// void Load(bool forceReload = false)
+//      Loads LogSettings.json (creates it with defaults if missing).
+//      Params:
+//          forceReload: re-read from disk even if already loaded
+//
+// bool IsEnabled(int level)
+//      True if messages at this TieredGasLogLevel would be printed.
+//      Params:
+//          level: TieredGasLogLevel value
+//
+// void LogError(string msg) / LogWarn / LogInfo / LogDebug / LogTrace
+//      Prints msg if its level is enabled.
+//      Params:
+//          msg: message (already prefixed by the caller, e.g. "[TieredGas] ...")
+//
+// void Limited(int level, string key, string msg)
+//      Like the above, but prints at most once per RateLimitSeconds for the given call-site key and
+//      reports how many messages were dropped in between.
+//      Params:
+//          level: TieredGasLogLevel value
+//          key: call-site key
+//          msg: message
+//---------------------------------------------------------------------------------------------------
+
+enum TieredGasLogLevel
+{
+    OFF   = 0,
+    ERROR = 1,
+    WARN  = 2,
+    INFO  = 3,
+    DEBUG = 4,
+    TRACE = 5
+};
+
+class TieredGasLogSettingsData
+{
+    int Level = TieredGasLogLevel.INFO;
+    float RateLimitSeconds = 10.0;
+}
+
+class TieredGasLog
+{
+    private static ref TieredGasLogSettingsData s_Data;
+    private static bool s_Loaded;
+    private static int s_Level = TieredGasLogLevel.INFO;
+    private static int s_RateLimitMS = 10000;
+
+    private static ref map<string, int> s_LastPrintMS;
+    private static ref map<string, int> s_Suppressed;
+
+    static string GetFolder()
+    {
+        return "$profile:TieredGas";
+    }
+
+    static string GetPath()
+    {
+        return GetFolder() + "/LogSettings.json";
+    }
+
+    static void Load(bool forceReload = false)
+    {
+        if (s_Loaded && !forceReload)
+            return;
+
+        string folder = GetFolder();
+        if (!FileExist(folder))
+            MakeDirectory(folder);
+
+        string path = GetPath();
+
+        s_Data = new TieredGasLogSettingsData();
+
+        if (FileExist(path))
+        {
+            JsonFileLoader<TieredGasLogSettingsData>.JsonLoadFile(path, s_Data);
+        }
+        else
+        {
+            JsonFileLoader<TieredGasLogSettingsData>.JsonSaveFile(path, s_Data);
+        }
+
+        s_Level = s_Data.Level;
+        if (s_Level < TieredGasLogLevel.OFF)   s_Level = TieredGasLogLevel.OFF;
+        if (s_Level > TieredGasLogLevel.TRACE) s_Level = TieredGasLogLevel.TRACE;
+
+        float rate = s_Data.RateLimitSeconds;
+        if (rate < 0) rate = 0;
+        s_RateLimitMS = rate * 1000.0;
+
+        s_LastPrintMS = new map<string, int>;
+        s_Suppressed = new map<string, int>;
+
+        s_Loaded = true;
+    }
+
+    static bool IsEnabled(int level)
+    {
+        if (!s_Loaded) Load();
+        return level <= s_Level;
+    }
+
+    static void LogError(string msg) { if (IsEnabled(TieredGasLogLevel.ERROR)) Print(msg); }
+    static void LogWarn(string msg)  { if (IsEnabled(TieredGasLogLevel.WARN))  Print(msg); }
+    static void LogInfo(string msg)  { if (IsEnabled(TieredGasLogLevel.INFO))  Print(msg); }
+    static void LogDebug(string msg) { if (IsEnabled(TieredGasLogLevel.DEBUG)) Print(msg); }
+    static void LogTrace(string msg) { if (IsEnabled(TieredGasLogLevel.TRACE)) Print(msg); }
+
+    static void Limited(int level, string key, string msg)
+    {
+        if (!IsEnabled(level)) return;
+
+        int now = 0;
+        if (GetGame()) now = GetGame().GetTime();
+
+        if (s_LastPrintMS.Contains(key) && (now - s_LastPrintMS.Get(key)) < s_RateLimitMS)
+        {
+            s_Suppressed.Set(key, s_Suppressed.Get(key) + 1);
+            return;
+        }
+
+        int dropped = s_Suppressed.Get(key);
+        s_LastPrintMS.Set(key, now);
+        s_Suppressed.Set(key, 0);
+
+        if (dropped > 0)
+            msg = msg + " (" + dropped.ToString() + " similar suppressed)";
+
+        Print(msg);
+    }
+}
@@ -3,6 +3,15 @@
 //
 // File summary: Client particle controller: spawns/updates/removes gas zone cloud particles and player-local effects; supports admin-menu preview particles.
 //
+//               Cloud emitters are not played/stopped in one loop: UpdateZoneCloud only queues the anchors
+//               (nearest to the player first) and retiring sets are queued with their fade deadline.
+//               OnUpdate works both queues off with a per-frame cap, so a dense zone ramps in over a few
+//               frames instead of hitching.
+//
+//               Stopped cloud emitters go to an idle pool keyed by particle ID (up to SetPoolMax() in
+//               total); queued spawns take a pooled emitter of the same ID, move it and restart it before
+//               creating a new one.
+//
 // TieredGasParticleManager
 //
 // void Init()
@@ -14,20 +23,56 @@
 //      Params:
 //          key: particle key/name used by TieredGas (ex: resolved cloud key)
 //
-// void UpdateZoneCloud(string uuid, array<vector> anchors, string key, float crossFadeSeconds)
+// void UpdateZoneCloud(string uuid, array<vector> anchors, string key, float crossFadeSeconds, bool forceRebuild = false)
 //      Ensures a zone’s cloud particles exist and match the given anchor positions; crossfades when changing particle type.
+//      New emitters are queued nearest-first and started by OnUpdate.
 //      Params:
 //          uuid: zone identifier
 //          anchors: particle spawn points (world positions)
 //          key: particle definition key to use
 //          crossFadeSeconds: fade time when switching particle sets
+//          forceRebuild: reconcile even if key and count match (anchor subset changed)
+//      With an unchanged key only the difference is applied: emitters whose anchor left the set stop at
+//      once, missing anchors are queued, the rest keep playing (no crossfade, so budget reselects never
+//      double the emitter count).
 //
 // void RemoveZoneCloud(string uuid, float fadeSeconds)
-//      Removes/fades out all particles associated with a zone UUID.
+//      Removes/fades out all particles associated with a zone UUID (stops are queued, not issued at once).
 //      Params:
 //          uuid: zone identifier
 //          fadeSeconds: fade-out duration
 //
+// void SetZoneCloudPaused(string uuid, bool paused)
+//      View culling: pausing stops the zone's live emitters (through the stop queue, into the pool) but
+//      keeps its anchors; resuming re-queues them nearest-first.
+//      Params:
+//          uuid: zone identifier
+//          paused: true to pause, false to resume
+//
+// int GetRetiringCount()
+//      Cloud emitters still playing while they wait in the stop queue (crossfades / removals); the global
+//      budget allocation counts them as used.
+//      Params: none
+//
+// void OnUpdate(int emittersPerFrame)
+//      Per-frame driver: stops due retired cloud emitters and starts queued ones, each capped per frame.
+//      Params:
+//          emittersPerFrame: max cloud emitters started (and, separately, stopped) this frame
+//
+// void SetPoolMax(int maxIdle)
+//      Caps how many stopped cloud emitters are kept for reuse across all particle IDs.
+//      Params:
+//          maxIdle: idle emitter cap (0 disables pooling)
+//
+// void GetPoolStats(out int hits, out int misses, out int idle)
+//      Pool counters since Init: spawns served from the pool, spawns that created a new emitter, and
+//      emitters currently idle (entries the engine already deleted are pruned first). Shown at the top
+//      of the admin menu's particles tab.
+//      Params:
+//          hits: pooled spawns (out)
+//          misses: newly created emitters (out)
+//          idle: live emitters waiting in the pool (out)
+//
 // void UpdatePlayerLocalFromZone(Object ownerZone, int ownerPriority, Object player, string key)
 //      Applies/updates a local particle effect on a player caused by a zone (typically “inside gas” effect).
 //      Params:
@@ -74,11 +119,54 @@
 //      Params: none
 //---------------------------------------------------------------------------------------------------
 
+class TieredGasCloudSet
+{
+    string key;
+    int id;
+    int anchorCount;
+    ref array<Particle> particles = new array<Particle>;
+    ref array<vector> liveAnchors = new array<vector>;   // anchor of each entry in particles
+
+    // Anchors not started yet, nearest first; entries before pendingCursor have been started.
+    ref array<vector> pending = new array<vector>;
+    int pendingCursor;
+    bool paused;
+};
+
+class TieredGasParticleStop
+{
+    Particle p;
+    int id;
+    int dueMs;
+
+    void TieredGasParticleStop(Particle particle, int particleId, int due)
+    {
+        p = particle;
+        id = particleId;
+        dueMs = due;
+    }
+};
+
 class TieredGasParticleManager
 {
-    
-    static ref map<string, ref array<Particle>> m_ZoneCloudParticles;
-    static ref map<string, string> m_ZoneCloudKey;
+    static const int STOP_QUEUE_COMPACT = 256;
+
+    static ref map<string, ref TieredGasCloudSet> m_ZoneClouds;
+
+    // Zone UUIDs with pending anchors, in request order.
+    static ref array<string> m_SpawnQueue;
+
+    // Retired cloud emitters ordered by dueMs; entries before m_StopCursor are done.
+    static ref array<ref TieredGasParticleStop> m_StopQueue;
+    static int m_StopCursor;
+
+    // Idle (stopped) cloud emitters by particle ID.
+    static ref map<int, ref array<Particle>> m_Pool;
+    static int m_PoolMax = 300;
+    static int m_PoolIdle;
+    static int m_PoolHits;
+    static int m_PoolMisses;
+    static int m_PoolPrunedMs = -1;
 
     
     static ref map<string, int> m_ParticleIdCache;
@@ -94,10 +182,16 @@ class TieredGasParticleManager
 
     static void Init()
     {
-        if (!m_ZoneCloudParticles)
+        if (!m_ZoneClouds)
         {
-            m_ZoneCloudParticles = new map<string, ref array<Particle>>;
-            m_ZoneCloudKey = new map<string, string>;
+            m_ZoneClouds = new map<string, ref TieredGasCloudSet>;
+            m_SpawnQueue = new array<string>;
+            m_StopQueue = new array<ref TieredGasParticleStop>;
+            m_StopCursor = 0;
+            m_Pool = new map<int, ref array<Particle>>;
+            m_PoolIdle = 0;
+            m_PoolHits = 0;
+            m_PoolMisses = 0;
             m_ParticleIdCache = new map<string, int>;
             m_PreviewParticles = new array<Particle>;
             Print("[TieredGasMod] Particle Manager initialized");
@@ -124,35 +218,19 @@ class TieredGasParticleManager
     
     
     
-    static void UpdateZoneCloud(string uuid, array<vector> anchors, string key, float crossFadeSeconds)
+    static void UpdateZoneCloud(string uuid, array<vector> anchors, string key, float crossFadeSeconds, bool forceRebuild = false)
     {
         if (uuid == "") return;
         if (!anchors || anchors.Count() == 0) return;
 
-        if (!m_ZoneCloudParticles) Init();
-
-        string oldKey = "";
-        if (m_ZoneCloudKey && m_ZoneCloudKey.Contains(uuid))
-        {
-            oldKey = m_ZoneCloudKey.Get(uuid);
-        }
+        if (!m_ZoneClouds) Init();
 
-        bool keyChanged = (oldKey != key);
+        TieredGasCloudSet cur;
+        m_ZoneClouds.Find(uuid, cur);
 
-        ref array<Particle> cur = null;
-        if (m_ZoneCloudParticles.Contains(uuid))
-        {
-            cur = m_ZoneCloudParticles.Get(uuid);
-        }
-
-        bool needRebuild = false;
-
-        if (!cur) needRebuild = true;
-        else if (keyChanged) needRebuild = true;
-        else if (cur.Count() != anchors.Count()) needRebuild = true;
-
-        if (!needRebuild)
+        if (cur && cur.key == key)
         {
+            if (forceRebuild || cur.anchorCount != anchors.Count()) ReconcileCloud(uuid, cur, anchors);
             return;
         }
 
@@ -163,22 +241,18 @@ class TieredGasParticleManager
             return;
         }
 
-        ref array<Particle> next = new array<Particle>;
-
-        for (int a = 0; a < anchors.Count(); a++)
-        {
-            Particle p = Particle.Play(id, anchors[a]);
-            next.Insert(p);
-        }
+        TieredGasCloudSet next = new TieredGasCloudSet();
+        next.key = key;
+        next.id = id;
+        next.anchorCount = anchors.Count();
+        SortNearestFirst(anchors, next.pending);
 
-        m_ZoneCloudParticles.Set(uuid, next);
-        if (!m_ZoneCloudKey) m_ZoneCloudKey = new map<string, string>;
-        m_ZoneCloudKey.Set(uuid, key);
+        m_ZoneClouds.Set(uuid, next);
+        if (m_SpawnQueue.Find(uuid) < 0) m_SpawnQueue.Insert(uuid);
 
-        if (cur && cur.Count() > 0)
+        if (cur)
         {
-            int ms = Math.Floor(crossFadeSeconds * 1000.0);
-            StopParticlesLater(cur, ms);
+            RetireCloud(cur, crossFadeSeconds);
         }
     }
 
@@ -188,29 +262,309 @@ class TieredGasParticleManager
     static void RemoveZoneCloud(string uuid, float fadeSeconds)
     {
         if (uuid == "") return;
-        
-        if (m_ZoneCloudParticles && m_ZoneCloudParticles.Contains(uuid))
+        if (!m_ZoneClouds) return;
+
+        TieredGasCloudSet cur;
+        if (m_ZoneClouds.Find(uuid, cur))
+        {
+            RetireCloud(cur, fadeSeconds);
+            m_ZoneClouds.Remove(uuid);
+        }
+    }
+
+    static void OnUpdate(int emittersPerFrame)
+    {
+        if (!m_ZoneClouds) return;
+        if (emittersPerFrame < 1) emittersPerFrame = 1;
+
+        int now = GetGame().GetTime();
+
+        int ops = emittersPerFrame;
+        while (ops > 0 && m_StopCursor < m_StopQueue.Count())
         {
-            array<Particle> particles = m_ZoneCloudParticles.Get(uuid);
-            if (particles)
+            TieredGasParticleStop stop = m_StopQueue[m_StopCursor];
+            if (stop.dueMs > now) break;
+
+            if (stop.p)
             {
-                
-                if (fadeSeconds <= 0.0)
-                {
-                    
-                    StopParticles(particles);
-                }
-                else
+                stop.p.Stop();
+                ReleaseToPool(stop.p, stop.id);
+            }
+            m_StopQueue[m_StopCursor] = null;
+            m_StopCursor++;
+            ops--;
+        }
+        CompactStopQueue();
+
+        ops = emittersPerFrame;
+        while (ops > 0 && m_SpawnQueue.Count() > 0)
+        {
+            TieredGasCloudSet cloud;
+            if (!m_ZoneClouds.Find(m_SpawnQueue[0], cloud) || cloud.paused || cloud.pendingCursor >= cloud.pending.Count())
+            {
+                if (cloud && !cloud.paused)
                 {
-                    
-                    int ms = Math.Floor(fadeSeconds * 1000.0);
-                    StopParticlesLater(particles, ms);
+                    cloud.pending.Clear();
+                    cloud.pendingCursor = 0;
                 }
+                m_SpawnQueue.RemoveOrdered(0);
+                continue;
             }
-            m_ZoneCloudParticles.Remove(uuid);
-            
-            if (m_ZoneCloudKey)
-                m_ZoneCloudKey.Remove(uuid);
+
+            vector anchor = cloud.pending[cloud.pendingCursor];
+            cloud.pendingCursor++;
+
+            Particle p = AcquireFromPool(cloud.id, anchor);
+            if (p)
+            {
+                cloud.particles.Insert(p);
+                cloud.liveAnchors.Insert(anchor);
+            }
+            ops--;
+        }
+    }
+
+    static void SetZoneCloudPaused(string uuid, bool paused)
+    {
+        if (!m_ZoneClouds) return;
+
+        TieredGasCloudSet cloud;
+        if (!m_ZoneClouds.Find(uuid, cloud) || cloud.paused == paused) return;
+
+        cloud.paused = paused;
+
+        // Every anchor becomes unstarted again: live ones (stopped now) plus those still queued.
+        array<vector> anchors = new array<vector>;
+        anchors.Copy(cloud.liveAnchors);
+        for (int i = cloud.pendingCursor; i < cloud.pending.Count(); i++)
+        {
+            anchors.Insert(cloud.pending[i]);
+        }
+
+        if (paused)
+        {
+            int now = GetGame().GetTime();
+            foreach (Particle p : cloud.particles)
+            {
+                if (p) QueueStop(p, cloud.id, now);
+            }
+            cloud.particles.Clear();
+            cloud.liveAnchors.Clear();
+            cloud.pending = anchors;
+            cloud.pendingCursor = 0;
+            return;
+        }
+
+        // The player may have moved while paused; restart from the anchors now nearest.
+        cloud.pending = new array<vector>;
+        cloud.pendingCursor = 0;
+        SortNearestFirst(anchors, cloud.pending);
+
+        if (m_SpawnQueue.Find(uuid) < 0) m_SpawnQueue.Insert(uuid);
+    }
+
+    // Hands a replaced/removed set's live emitters to the stop queue; anchors never started are dropped.
+    protected static void RetireCloud(TieredGasCloudSet cloud, float fadeSeconds)
+    {
+        if (!cloud) return;
+
+        int due = GetGame().GetTime();
+        if (fadeSeconds > 0.0) due += Math.Floor(fadeSeconds * 1000.0);
+
+        foreach (Particle p : cloud.particles)
+        {
+            if (p) QueueStop(p, cloud.id, due);
+        }
+        cloud.particles.Clear();
+        cloud.liveAnchors.Clear();
+        cloud.pending.Clear();
+        cloud.pendingCursor = 0;
+    }
+
+    // Same particle key, different anchor subset: stop only what left, queue only what is new.
+    protected static void ReconcileCloud(string uuid, TieredGasCloudSet cloud, array<vector> anchors)
+    {
+        map<string, bool> wanted = new map<string, bool>;
+        foreach (vector a : anchors)
+        {
+            wanted.Set(a.ToString(false), true);
+        }
+
+        int now = GetGame().GetTime();
+        for (int i = cloud.particles.Count() - 1; i >= 0; i--)
+        {
+            string liveKey = cloud.liveAnchors[i].ToString(false);
+            if (wanted.Contains(liveKey))
+            {
+                wanted.Remove(liveKey);
+                continue;
+            }
+
+            if (cloud.particles[i]) QueueStop(cloud.particles[i], cloud.id, now);
+            cloud.particles.Remove(i);
+            cloud.liveAnchors.Remove(i);
+        }
+
+        array<vector> missing = new array<vector>;
+        foreach (vector b : anchors)
+        {
+            if (wanted.Contains(b.ToString(false))) missing.Insert(b);
+        }
+
+        cloud.anchorCount = anchors.Count();
+        cloud.pending = new array<vector>;
+        cloud.pendingCursor = 0;
+        SortNearestFirst(missing, cloud.pending);
+
+        if (!cloud.paused && cloud.pending.Count() > 0 && m_SpawnQueue.Find(uuid) < 0) m_SpawnQueue.Insert(uuid);
+    }
+
+    static int GetRetiringCount()
+    {
+        if (!m_StopQueue) return 0;
+        return m_StopQueue.Count() - m_StopCursor;
+    }
+
+    protected static void QueueStop(Particle p, int id, int dueMs)
+    {
+        // Usually appends; a shorter fade queued after a longer one is inserted in order.
+        int i = m_StopQueue.Count();
+        while (i > m_StopCursor && m_StopQueue[i - 1].dueMs > dueMs)
+        {
+            i--;
+        }
+        m_StopQueue.InsertAt(new TieredGasParticleStop(p, id, dueMs), i);
+    }
+
+    protected static Particle AcquireFromPool(int id, vector pos)
+    {
+        array<Particle> idle;
+        if (m_Pool.Find(id, idle))
+        {
+            // Entries can be null if the engine deleted the emitter after it finished.
+            while (idle.Count() > 0)
+            {
+                int last = idle.Count() - 1;
+                Particle p = idle[last];
+                idle.Remove(last);
+                m_PoolIdle--;
+
+                if (!p) continue;
+
+                p.SetPosition(pos);
+                p.PlayParticle();
+                m_PoolHits++;
+                return p;
+            }
+        }
+
+        m_PoolMisses++;
+        if (TieredGasLog.IsEnabled(TieredGasLogLevel.DEBUG))
+            TieredGasLog.Limited(TieredGasLogLevel.DEBUG, "tg_particle_pool", "[TieredGas] Particle pool hits=" + m_PoolHits + " misses=" + m_PoolMisses + " idle=" + m_PoolIdle);
+
+        return Particle.Play(id, pos);
+    }
+
+    protected static void ReleaseToPool(Particle p, int id)
+    {
+        // Only count live entries against the cap: emitters the engine deleted leave null slots behind.
+        int now = GetGame().GetTime();
+        if (m_PoolIdle >= m_PoolMax && now != m_PoolPrunedMs)
+        {
+            m_PoolPrunedMs = now;
+            PrunePool();
+        }
+        if (m_PoolIdle >= m_PoolMax) return;
+
+        array<Particle> idle;
+        if (!m_Pool.Find(id, idle))
+        {
+            idle = new array<Particle>;
+            m_Pool.Insert(id, idle);
+        }
+        idle.Insert(p);
+        m_PoolIdle++;
+    }
+
+    protected static void PrunePool()
+    {
+        if (!m_Pool) return;
+
+        int live = 0;
+        foreach (int id, array<Particle> idle : m_Pool)
+        {
+            for (int i = idle.Count() - 1; i >= 0; i--)
+            {
+                if (!idle[i]) idle.Remove(i);
+            }
+            live += idle.Count();
+        }
+        m_PoolIdle = live;
+    }
+
+    static void SetPoolMax(int maxIdle)
+    {
+        if (maxIdle < 0) maxIdle = 0;
+        m_PoolMax = maxIdle;
+    }
+
+    static void GetPoolStats(out int hits, out int misses, out int idle)
+    {
+        PrunePool();
+
+        hits = m_PoolHits;
+        misses = m_PoolMisses;
+        idle = m_PoolIdle;
+    }
+
+    protected static void CompactStopQueue()
+    {
+        if (m_StopCursor == 0) return;
+
+        if (m_StopCursor >= m_StopQueue.Count())
+        {
+            m_StopQueue.Clear();
+            m_StopCursor = 0;
+            return;
+        }
+
+        if (m_StopCursor < STOP_QUEUE_COMPACT) return;
+
+        array<ref TieredGasParticleStop> rest = new array<ref TieredGasParticleStop>;
+        for (int i = m_StopCursor; i < m_StopQueue.Count(); i++)
+        {
+            rest.Insert(m_StopQueue[i]);
+        }
+        m_StopQueue = rest;
+        m_StopCursor = 0;
+    }
+
+    // key = distance (m) << 12 | anchor index; anchor layouts stay far below 4096 entries
+    protected static void SortNearestFirst(array<vector> anchors, array<vector> outSorted)
+    {
+        int count = anchors.Count();
+
+        vector origin = GetGame().GetCurrentCameraPosition();
+        Man player = GetGame().GetPlayer();
+        if (player) origin = player.GetPosition();
+
+        if (count > 4096)
+        {
+            outSorted.Copy(anchors);
+            return;
+        }
+
+        array<int> keys = new array<int>;
+        for (int i = 0; i < count; i++)
+        {
+            int rank = vector.Distance(origin, anchors[i]);
+            keys.Insert((rank << 12) | i);
+        }
+        keys.Sort();
+
+        foreach (int key : keys)
+        {
+            outSorted.Insert(anchors[key & 0xFFF]);
         }
     }
 
@@ -220,7 +574,7 @@ class TieredGasParticleManager
     static void UpdatePlayerLocalFromZone(Object ownerZone, int ownerPriority, Object player, string key)
     {
         if (!ownerZone || !player) return;
-        if (!m_ZoneCloudParticles) Init();
+        if (!m_ZoneClouds) Init();
 
         
         bool takeOwnership = false;
@@ -380,18 +734,37 @@ class TieredGasParticleManager
         m_PlayerLocalOwnerPriority = 0;
 
         
-        if (m_ZoneCloudParticles)
+        if (m_ZoneClouds)
+        {
+            foreach (string uuid, TieredGasCloudSet cloud : m_ZoneClouds)
+            {
+                if (cloud) StopParticles(cloud.particles);
+            }
+            m_ZoneClouds.Clear();
+        }
+
+        if (m_StopQueue)
         {
-            foreach (string uuid, ref array<Particle> ps : m_ZoneCloudParticles)
+            for (int i = m_StopCursor; i < m_StopQueue.Count(); i++)
             {
-                StopParticles(ps);
+                if (m_StopQueue[i] && m_StopQueue[i].p) m_StopQueue[i].p.Stop();
             }
-            m_ZoneCloudParticles.Clear();
+            m_StopQueue.Clear();
+            m_StopCursor = 0;
         }
 
-        if (m_ZoneCloudKey)
+        if (m_SpawnQueue)
         {
-            m_ZoneCloudKey.Clear();
+            m_SpawnQueue.Clear();
+        }
+
+        if (m_Pool)
+        {
+            if (TieredGasLog.IsEnabled(TieredGasLogLevel.DEBUG))
+                TieredGasLog.LogDebug("[TieredGas] Particle pool final hits=" + m_PoolHits + " misses=" + m_PoolMisses + " idle=" + m_PoolIdle);
+
+            m_Pool.Clear();
+            m_PoolIdle = 0;
         }
 
         if (m_ParticleIdCache)
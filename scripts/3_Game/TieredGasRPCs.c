@@ -6,9 +6,12 @@
 // Functions: none (constants only).
 //---------------------------------------------------------------------------------------------------
 
-const int RPC_TIERED_GAS_UPDATE        = 90001; 
 const int RPC_TIERED_GAS_ZONES_REQUEST = 90002; 
 const int RPC_TIERED_GAS_ZONES_SYNC    = 90003; 
+const int RPC_TIERED_GAS_ZONES_SYNC_BIN = 90004;
+const int RPC_TIERED_GAS_ZONES_DELTA    = 90005;
+const int RPC_TIERED_GAS_ZONES_UNCHANGED = 90006;
+const int RPC_TIERED_GAS_ZONES_INTEREST  = 90007;
 
 const int RPC_ADMIN_LIST_ZONES        = 90010;
 const int RPC_ADMIN_SPAWN_ZONE        = 90011;
@@ -20,6 +23,7 @@ const int RPC_ADMIN_CHECK             = 90016;
 const int RPC_ADMIN_CHECK_RESPONSE    = 90017;
 const int RPC_ADMIN_RELOAD_ZONES      = 90018;
 const int RPC_ADMIN_REMOVE_ZONE_BY_UUID = 90019;
+const int RPC_ADMIN_BENCHMARK_ZONES   = 90020;
 
 const int MENU_TIEREDGAS_ADMIN        = 91000;
 
@@ -14,6 +14,26 @@
 //      Parses a string gas type name into the numeric ID.
 //      Params:
 //          s: string type name
+//
+// int DensityStringToEnum(string s)
+//      Parses a zone density string (low/normal/dense + aliases) into TieredGasDensity.
+//      Params:
+//          s: density string
+//
+// string DensityEnumToString(int density)
+//      Converts a TieredGasDensity value back to its config string.
+//      Params:
+//          density: density enum value
+//
+// int ColorStringToCode(string colorId)
+//      Index of a built-in cloud color (particle set) or -1 for custom color ids.
+//      Params:
+//          colorId: zone color id
+//
+// string ColorCodeToString(int code)
+//      Built-in color id for a code returned by ColorStringToCode ("default" if out of range).
+//      Params:
+//          code: color code
 //---------------------------------------------------------------------------------------------------
 
 enum TieredGasType
@@ -23,6 +43,13 @@ enum TieredGasType
     BIO   = 2
 };
 
+enum TieredGasDensity
+{
+    LOW    = 0,
+    NORMAL = 1,
+    DENSE  = 2
+};
+
 class TieredGasTypes
 {
     static string GasTypeToString(int type)
@@ -43,4 +70,41 @@ class TieredGasTypes
         if (name == "BIO")   { return TieredGasType.BIO; }
         return TieredGasType.TOXIC;
     }
+
+    static int DensityStringToEnum(string name)
+    {
+        name = name.Trim();
+        name.ToLower();
+
+        if (name == "low" || name == "light" || name == "lo") { return TieredGasDensity.LOW; }
+        if (name == "dense" || name == "thick") { return TieredGasDensity.DENSE; }
+        return TieredGasDensity.NORMAL;
+    }
+
+    static string DensityEnumToString(int density)
+    {
+        switch (density)
+        {
+            case TieredGasDensity.LOW:   return "low";
+            case TieredGasDensity.DENSE: return "dense";
+        }
+        return "normal";
+    }
+
+    // Order is part of the binary zone sync format: append only.
+    static ref array<string> COLOR_IDS = { "default", "black", "blue", "cyan", "green", "orange", "pink", "purple", "red", "white", "yellow" };
+
+    static int ColorStringToCode(string colorId)
+    {
+        colorId = colorId.Trim();
+        colorId.ToLower();
+        if (colorId == "") return 0;
+        return COLOR_IDS.Find(colorId);
+    }
+
+    static string ColorCodeToString(int code)
+    {
+        if (code < 0 || code >= COLOR_IDS.Count()) return "default";
+        return COLOR_IDS[code];
+    }
 };
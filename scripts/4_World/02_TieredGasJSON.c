@@ -39,6 +39,57 @@
 //      Params:
 //          cfg: zone config
 //
+// int GetSchedulerBuckets()
+//      Number of phase buckets the server gas scheduler spreads players across (GasSettings.json).
+//      Params: none
+//
+// int GetSchedulerMaxPlayersPerFrame()
+//      Per-frame budget of player gas ticks for the server scheduler (GasSettings.json).
+//      Params: none
+//
+// float GetAdaptiveMaxPlayerSpeed()
+//      Fastest player speed (m/s) assumed when sizing the per-player zone search radius.
+//      Params: none
+//
+// float GetAdaptiveMaxRecheckSeconds()
+//      Upper bound (seconds) between two zone checks of the same player.
+//      Params: none
+//
+// float GetAdaptiveSearchRadius()
+//      Distance beyond which zones cannot be reached before the next forced recheck (speed * max seconds).
+//      Params: none
+//
+// float GetZoneCacheMoveThreshold()
+//      Zones whose edge is closer than this are cached per player and retested on movement; the full
+//      zone query only reruns after moving this far (or to the next uncached zone, if further).
+//      Params: none
+//
+// bool UseBinaryZoneSync()
+//      True unless zoneSyncFormat in GasSettings.json selects the legacy JSON chunks (0).
+//      Params: none
+//
+// float GetZoneInterestRadius()
+//      Zone edge distance within which a zone is streamed to a player (0 = interest streaming off, every
+//      client receives the whole zone set).
+//      Params: none
+//
+// float GetZoneInterestHysteresis()
+//      Extra distance beyond the interest radius before a streamed zone is removed from the client again.
+//      Params: none
+//
+// int GetZoneBroadcastQuietMS()
+//      Quiet window after the last zone edit before the zone file is saved and clients are updated
+//      (zoneBroadcastQuietSeconds).
+//      Params: none
+//
+// int GetZoneSyncBytesPerFrame()
+//      Approximate zone sync bytes sent per server frame while a broadcast is being drained.
+//      Params: none
+//
+// TieredGasCompiledSettings GetCompiled()
+//      Int-indexed snapshot of the loaded settings for hot paths (rebuilt on every Load).
+//      Params: none
+//
 // bool LoadZonesFromJSON(out array<ref GasZoneConfig> zones)
 //      Loads the zones list from the zones JSON file.
 //      Params (out):
@@ -158,6 +209,26 @@ class TieredGasJSON_Instance
     string protectionSlot;
 
     ref map<int, string> protectionClassItemsByTier;
+
+    // Server gas scheduler (TieredGasServerScheduler)
+    int schedulerBuckets;
+    int schedulerMaxPlayersPerFrame;
+
+    // Distance-adaptive zone evaluation (full zone queries only after moving far enough to reach a new zone)
+    float adaptiveMaxPlayerSpeed;
+    float adaptiveMaxRecheckSeconds;
+    float zoneCacheMoveThreshold;
+
+    // Zone sync wire format: 1 = binary (RPC_TIERED_GAS_ZONES_SYNC_BIN), 0 = legacy JSON chunks
+    int zoneSyncFormat = -1;
+
+    // Interest-managed zone streaming: 0 = off (full zone set on every client)
+    float zoneInterestRadius = -1;
+    float zoneInterestHysteresis;
+
+    // Coalesced zone broadcasts: quiet window after the last edit, then a byte budget per frame
+    float zoneBroadcastQuietSeconds = -1;
+    int zoneSyncBytesPerFrame;
 }
 
 class TieredGasJSON
@@ -219,6 +290,20 @@ class TieredGasJSON
     static string s_ProtectionSlot = "Armband";
     static ref map<int, string> s_ProtectionClassItemsByTier;
 
+    static int s_SchedulerBuckets = 10;
+    static int s_SchedulerMaxPlayersPerFrame = 8;
+
+    static float s_AdaptiveMaxPlayerSpeed = 9.0;
+    static float s_AdaptiveMaxRecheckSeconds = 30.0;
+    static float s_ZoneCacheMoveThreshold = 25.0;
+    static int s_ZoneSyncFormat = 1;
+    static float s_ZoneInterestRadius = 0.0;
+    static float s_ZoneInterestHysteresis = 250.0;
+    static float s_ZoneBroadcastQuietSeconds = 2.0;
+    static int s_ZoneSyncBytesPerFrame = 16384;
+
+    static ref TieredGasCompiledSettings s_Compiled;
+
     static bool m_Loaded = false;
 
     static void Load(bool forceReload = false)
@@ -277,6 +362,17 @@ class TieredGasJSON
                     s_ProtectionClassItemsByTier = loaded.protectionClassItemsByTier;
                 else { s_ProtectionClassItemsByTier = defaults.protectionClassItemsByTier; needsSave = true; }
 
+                if (loaded.schedulerBuckets > 0) s_SchedulerBuckets = loaded.schedulerBuckets; else { s_SchedulerBuckets = defaults.schedulerBuckets; needsSave = true; }
+                if (loaded.schedulerMaxPlayersPerFrame > 0) s_SchedulerMaxPlayersPerFrame = loaded.schedulerMaxPlayersPerFrame; else { s_SchedulerMaxPlayersPerFrame = defaults.schedulerMaxPlayersPerFrame; needsSave = true; }
+                if (loaded.adaptiveMaxPlayerSpeed > 0) s_AdaptiveMaxPlayerSpeed = loaded.adaptiveMaxPlayerSpeed; else { s_AdaptiveMaxPlayerSpeed = defaults.adaptiveMaxPlayerSpeed; needsSave = true; }
+                if (loaded.adaptiveMaxRecheckSeconds > 0) s_AdaptiveMaxRecheckSeconds = loaded.adaptiveMaxRecheckSeconds; else { s_AdaptiveMaxRecheckSeconds = defaults.adaptiveMaxRecheckSeconds; needsSave = true; }
+                if (loaded.zoneCacheMoveThreshold > 0) s_ZoneCacheMoveThreshold = loaded.zoneCacheMoveThreshold; else { s_ZoneCacheMoveThreshold = defaults.zoneCacheMoveThreshold; needsSave = true; }
+                if (loaded.zoneSyncFormat >= 0) s_ZoneSyncFormat = loaded.zoneSyncFormat; else { s_ZoneSyncFormat = defaults.zoneSyncFormat; needsSave = true; }
+                if (loaded.zoneInterestRadius >= 0) s_ZoneInterestRadius = loaded.zoneInterestRadius; else { s_ZoneInterestRadius = defaults.zoneInterestRadius; needsSave = true; }
+                if (loaded.zoneInterestHysteresis > 0) s_ZoneInterestHysteresis = loaded.zoneInterestHysteresis; else { s_ZoneInterestHysteresis = defaults.zoneInterestHysteresis; needsSave = true; }
+                if (loaded.zoneBroadcastQuietSeconds >= 0) s_ZoneBroadcastQuietSeconds = loaded.zoneBroadcastQuietSeconds; else { s_ZoneBroadcastQuietSeconds = defaults.zoneBroadcastQuietSeconds; needsSave = true; }
+                if (loaded.zoneSyncBytesPerFrame > 0) s_ZoneSyncBytesPerFrame = loaded.zoneSyncBytesPerFrame; else { s_ZoneSyncBytesPerFrame = defaults.zoneSyncBytesPerFrame; needsSave = true; }
+
                 Print("[TieredGas] Settings loaded from JSON.");
             }
             else
@@ -297,6 +393,16 @@ class TieredGasJSON
                 s_ToxicBleedChanceCap     = defaults.toxicBleedChanceCap;
                 s_BioInfectionChanceByTier = defaults.bioInfectionChanceByTier;
                 s_BioInfectionChanceCap    = defaults.bioInfectionChanceCap;
+                s_SchedulerBuckets           = defaults.schedulerBuckets;
+                s_SchedulerMaxPlayersPerFrame = defaults.schedulerMaxPlayersPerFrame;
+                s_AdaptiveMaxPlayerSpeed     = defaults.adaptiveMaxPlayerSpeed;
+                s_AdaptiveMaxRecheckSeconds  = defaults.adaptiveMaxRecheckSeconds;
+                s_ZoneCacheMoveThreshold     = defaults.zoneCacheMoveThreshold;
+                s_ZoneSyncFormat             = defaults.zoneSyncFormat;
+                s_ZoneInterestRadius         = defaults.zoneInterestRadius;
+                s_ZoneInterestHysteresis     = defaults.zoneInterestHysteresis;
+                s_ZoneBroadcastQuietSeconds  = defaults.zoneBroadcastQuietSeconds;
+                s_ZoneSyncBytesPerFrame      = defaults.zoneSyncBytesPerFrame;
                 Print("[TieredGas] Failed to load JSON, using defaults.");
                 needsSave = true;
             }
@@ -321,6 +427,17 @@ class TieredGasJSON
                 merged.protectionSlot = s_ProtectionSlot;
                 merged.protectionClassItemsByTier = s_ProtectionClassItemsByTier;
 
+                merged.schedulerBuckets = s_SchedulerBuckets;
+                merged.schedulerMaxPlayersPerFrame = s_SchedulerMaxPlayersPerFrame;
+                merged.adaptiveMaxPlayerSpeed = s_AdaptiveMaxPlayerSpeed;
+                merged.adaptiveMaxRecheckSeconds = s_AdaptiveMaxRecheckSeconds;
+                merged.zoneCacheMoveThreshold = s_ZoneCacheMoveThreshold;
+                merged.zoneSyncFormat = s_ZoneSyncFormat;
+                merged.zoneInterestRadius = s_ZoneInterestRadius;
+                merged.zoneInterestHysteresis = s_ZoneInterestHysteresis;
+                merged.zoneBroadcastQuietSeconds = s_ZoneBroadcastQuietSeconds;
+                merged.zoneSyncBytesPerFrame = s_ZoneSyncBytesPerFrame;
+
                 JsonFileLoader<TieredGasJSON_Instance>.JsonSaveFile(path, merged);
                 Print("[TieredGas] Migrated GasSettings.json with new protection fields.");
             }
@@ -337,13 +454,28 @@ class TieredGasJSON
             s_FXByTier      = defaults.FXByTier;
             s_ProtectionSlot = defaults.protectionSlot;
             s_ProtectionClassItemsByTier = defaults.protectionClassItemsByTier;
+            s_SchedulerBuckets = defaults.schedulerBuckets;
+            s_SchedulerMaxPlayersPerFrame = defaults.schedulerMaxPlayersPerFrame;
+            s_AdaptiveMaxPlayerSpeed = defaults.adaptiveMaxPlayerSpeed;
+            s_AdaptiveMaxRecheckSeconds = defaults.adaptiveMaxRecheckSeconds;
+            s_ZoneCacheMoveThreshold = defaults.zoneCacheMoveThreshold;
+            s_ZoneSyncFormat = defaults.zoneSyncFormat;
+            s_ZoneInterestRadius = defaults.zoneInterestRadius;
+            s_ZoneInterestHysteresis = defaults.zoneInterestHysteresis;
+            s_ZoneBroadcastQuietSeconds = defaults.zoneBroadcastQuietSeconds;
+            s_ZoneSyncBytesPerFrame = defaults.zoneSyncBytesPerFrame;
             JsonFileLoader<TieredGasJSON_Instance>.JsonSaveFile(path, defaults);
             Print("[TieredGas] Created default GasSettings.json");
         }
 
         EnsureEffectDefaults();
+        TieredGasProtection.BumpEpoch();
 
         m_Loaded = true;
+
+        // Built from the statics above, then swapped in with a single assignment.
+        s_Compiled = TieredGasCompiledSettings.Compile();
+
         Print("[TieredGas] Settings ready.");
     }
 
@@ -379,6 +511,17 @@ class TieredGasJSON
         inst.protectionClassItemsByTier.Insert(3, "NBCSuit_Tier3");
         inst.protectionClassItemsByTier.Insert(4, "NBCSuit_Tier4");
 
+        inst.schedulerBuckets = 10;
+        inst.schedulerMaxPlayersPerFrame = 8;
+
+        inst.adaptiveMaxPlayerSpeed = 9.0;
+        inst.adaptiveMaxRecheckSeconds = 30.0;
+        inst.zoneCacheMoveThreshold = 25.0;
+        inst.zoneSyncFormat = 1;
+        inst.zoneInterestRadius = 0.0;
+        inst.zoneInterestHysteresis = 250.0;
+        inst.zoneBroadcastQuietSeconds = 2.0;
+        inst.zoneSyncBytesPerFrame = 16384;
 
         inst.NerveExposure = new TieredGasNerveExposureConfig();
         inst.NerveExposure.threshold = 180.0;
@@ -491,6 +634,50 @@ class TieredGasJSON
         return 0;
     }
 
+    static int GetSchedulerBuckets()
+    {
+        if (!m_Loaded) { Load(); }
+        if (s_SchedulerBuckets < 1)  s_SchedulerBuckets = 1;
+        if (s_SchedulerBuckets > 60) s_SchedulerBuckets = 60;
+        return s_SchedulerBuckets;
+    }
+
+    static int GetSchedulerMaxPlayersPerFrame()
+    {
+        if (!m_Loaded) { Load(); }
+        if (s_SchedulerMaxPlayersPerFrame < 1) s_SchedulerMaxPlayersPerFrame = 1;
+        return s_SchedulerMaxPlayersPerFrame;
+    }
+
+    static float GetAdaptiveMaxPlayerSpeed()
+    {
+        if (!m_Loaded) { Load(); }
+        if (s_AdaptiveMaxPlayerSpeed < 1.0) s_AdaptiveMaxPlayerSpeed = 1.0;
+        return s_AdaptiveMaxPlayerSpeed;
+    }
+
+    static float GetAdaptiveMaxRecheckSeconds()
+    {
+        if (!m_Loaded) { Load(); }
+        if (s_AdaptiveMaxRecheckSeconds < 1.0)   s_AdaptiveMaxRecheckSeconds = 1.0;
+        if (s_AdaptiveMaxRecheckSeconds > 120.0) s_AdaptiveMaxRecheckSeconds = 120.0;
+        return s_AdaptiveMaxRecheckSeconds;
+    }
+
+    static float GetAdaptiveSearchRadius()
+    {
+        return GetAdaptiveMaxPlayerSpeed() * GetAdaptiveMaxRecheckSeconds();
+    }
+
+    static float GetZoneCacheMoveThreshold()
+    {
+        if (!m_Loaded) { Load(); }
+        if (s_ZoneCacheMoveThreshold < 1.0) s_ZoneCacheMoveThreshold = 1.0;
+        float cap = GetAdaptiveSearchRadius();
+        if (s_ZoneCacheMoveThreshold > cap) s_ZoneCacheMoveThreshold = cap;
+        return s_ZoneCacheMoveThreshold;
+    }
+
     static float GetNerveExposureThreshold()
     {
         if (!m_Loaded) { Load(); }
@@ -579,11 +766,52 @@ class TieredGasJSON
         if (fx) return fx.nerveVignetteBase;
         return 0.15;
     }
+    static bool UseBinaryZoneSync()
+    {
+        if (!m_Loaded) { Load(); }
+        return s_ZoneSyncFormat != 0;
+    }
+
+    static float GetZoneInterestRadius()
+    {
+        if (!m_Loaded) { Load(); }
+        if (s_ZoneInterestRadius < 0.0) s_ZoneInterestRadius = 0.0;
+        return s_ZoneInterestRadius;
+    }
+
+    static float GetZoneInterestHysteresis()
+    {
+        if (!m_Loaded) { Load(); }
+        if (s_ZoneInterestHysteresis < 1.0) s_ZoneInterestHysteresis = 1.0;
+        return s_ZoneInterestHysteresis;
+    }
+
+    static int GetZoneBroadcastQuietMS()
+    {
+        if (!m_Loaded) { Load(); }
+        if (s_ZoneBroadcastQuietSeconds < 0.0) s_ZoneBroadcastQuietSeconds = 0.0;
+        if (s_ZoneBroadcastQuietSeconds > 30.0) s_ZoneBroadcastQuietSeconds = 30.0;
+        return s_ZoneBroadcastQuietSeconds * 1000.0;
+    }
+
+    static int GetZoneSyncBytesPerFrame()
+    {
+        if (!m_Loaded) { Load(); }
+        if (s_ZoneSyncBytesPerFrame < 1024) s_ZoneSyncBytesPerFrame = 1024;
+        return s_ZoneSyncBytesPerFrame;
+    }
+
+    static TieredGasCompiledSettings GetCompiled()
+    {
+        if (!s_Compiled) { Load(); }
+        return s_Compiled;
+    }
+
     static GasTypeData GetGasType(string name)
     {
         if (!s_GasTypes) { Load(); }
         if (s_GasTypes.Contains(name)) { return s_GasTypes.Get(name); }
-        Print("[TieredGas] Warning: GasTypeData not found for: " + name);
+        TieredGasLog.Limited(TieredGasLogLevel.WARN, "GetGasType", "[TieredGas] Warning: GasTypeData not found for: " + name);
         return null;
     }
 
@@ -591,7 +819,7 @@ class TieredGasJSON
     {
         if (!s_Tiers) { Load(); }
         if (s_Tiers.Contains(tier)) { return s_Tiers.Get(tier); }
-        Print("[TieredGas] Warning: GasTierData not found for tier: " + tier);
+        TieredGasLog.Limited(TieredGasLogLevel.WARN, "GetTier", "[TieredGas] Warning: GasTierData not found for tier: " + tier);
         return null;
     }
 
@@ -780,6 +1008,9 @@ class TieredGasJSON
             defaults.spacingByDensity        = new map<string, float>();
             defaults.jitterByDensity         = new map<string, float>();
             defaults.maxAnchorsHardCap = 600;
+            defaults.maxCloudParticlesGlobal = 900;
+            defaults.cloudEmittersPerFrame = 24;
+            defaults.cloudEmitterPoolSize = 300;
         }
 
         ref TG_AdvancedTieredGasSetting result;
@@ -813,6 +1044,9 @@ class TieredGasJSON
         if (!result.spacingByDensity)       { result.spacingByDensity        = defaults.spacingByDensity; needsSave = true; }
         if (!result.jitterByDensity)        { result.jitterByDensity         = defaults.jitterByDensity; needsSave = true; }
         if (result.maxAnchorsHardCap <= 0)  { result.maxAnchorsHardCap       = defaults.maxAnchorsHardCap; needsSave = true; }
+        if (result.maxCloudParticlesGlobal <= 0) { result.maxCloudParticlesGlobal = defaults.maxCloudParticlesGlobal; needsSave = true; }
+        if (result.cloudEmittersPerFrame <= 0) { result.cloudEmittersPerFrame = defaults.cloudEmittersPerFrame; needsSave = true; }
+        if (result.cloudEmitterPoolSize < 0) { result.cloudEmitterPoolSize = defaults.cloudEmitterPoolSize; needsSave = true; }
 
         if (needsSave)
         {
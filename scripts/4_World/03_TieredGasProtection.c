@@ -34,28 +34,178 @@
 //          gasTier: severity tier
 //          deltaTime: time step used for scaling wear
 //
-// void DrainGasFilter(PlayerBase player, float deltaTime, int gasType)
+// void DrainGasFilter(PlayerBase player, float deltaTime, float drainRate)
 //      Drains gas filter/consumable over time while in gas.
 //      Params:
 //          player: player
 //          deltaTime: time step
-//          gasType: gas type (can drain differently by type)
+//          drainRate: per-second drain for the gas type + tier (TieredGasCompiledTier.filterDrain)
+//
+// TieredGasProtectionSnapshot GetSnapshot(PlayerBase player)
+//      Returns the player's cached protection state (suit, tier, immunity, mask, filter), rebuilding it only
+//      after an attachment / health-level change or a settings reload invalidated it.
+//      Params:
+//          player: player
+//
+// void Invalidate(PlayerBase player)
+//      Marks the player's snapshot stale (attach/detach hooks).
+//      Params:
+//          player: player
+//
+// void InvalidateOwner(EntityAI item)
+//      Marks the snapshot of the player carrying this item stale (mask/filter/suit changes).
+//      Params:
+//          item: item whose state changed
+//
+// void BumpEpoch()
+//      Invalidates every snapshot at once (settings reload can change the protection slot / tier map).
+//      Params: none
 //---------------------------------------------------------------------------------------------------
 
+class TieredGasProtectionSnapshot
+{
+    int epoch = -1;
+    bool dirty = true;
+
+    ItemBase suit;
+    int suitTier;
+    float suitMaxHealth;
+    bool immune;
+
+    ItemBase mask;
+    bool maskValid;
+    ItemBase filter;
+};
+
 class TieredGasProtection
 {
-    static ItemBase GetProtectionItem(PlayerBase player)
+    static int s_Epoch = 0;
+
+    // Slot ids resolved once per epoch instead of per lookup.
+    static int s_SlotsEpoch = -1;
+    static int s_SlotProtection = -1;
+    static string s_SlotProtectionName;
+    static int s_SlotMask = -1;
+    static int s_SlotFilter = -1;
+    static int s_SlotFilterAlt = -1;
+
+    static void BumpEpoch()
+    {
+        s_Epoch++;
+    }
+
+    static void EnsureSlots()
+    {
+        if (s_SlotsEpoch == s_Epoch) return;
+        s_SlotsEpoch = s_Epoch;
+
+        s_SlotProtectionName = TieredGasJSON.GetProtectionSlot();
+        if (!s_SlotProtectionName || s_SlotProtectionName.Length() == 0)
+            s_SlotProtectionName = "Armband";
+
+        s_SlotProtection = InventorySlots.GetSlotIdFromString(s_SlotProtectionName);
+        s_SlotMask       = InventorySlots.GetSlotIdFromString("Mask");
+        s_SlotFilter     = InventorySlots.GetSlotIdFromString("GasMaskFilter");
+        s_SlotFilterAlt  = InventorySlots.GetSlotIdFromString("GasFilter");
+    }
+
+    static TieredGasProtectionSnapshot GetSnapshot(PlayerBase player)
     {
         if (!player) return null;
 
-        string slotName = TieredGasJSON.GetProtectionSlot();
-        if (!slotName || slotName.Length() == 0)
-            slotName = "Armband";
+        TieredGasProtectionSnapshot snap = player.m_TG_Protection;
+        if (!snap)
+        {
+            snap = new TieredGasProtectionSnapshot();
+            player.m_TG_Protection = snap;
+        }
+
+        if (snap.dirty || snap.epoch != s_Epoch)
+            RebuildSnapshot(player, snap);
+
+        return snap;
+    }
 
-        ItemBase it = ItemBase.Cast(player.FindAttachmentBySlotName(slotName));
-        if (it) return it;
+    static void Invalidate(PlayerBase player)
+    {
+        if (player && player.m_TG_Protection)
+            player.m_TG_Protection.dirty = true;
+    }
 
-        return ItemBase.Cast(player.GetItemOnSlot(slotName));
+    static void InvalidateOwner(EntityAI item)
+    {
+        if (!item) return;
+        Invalidate(PlayerBase.Cast(item.GetHierarchyRootPlayer()));
+    }
+
+    protected static void RebuildSnapshot(PlayerBase player, TieredGasProtectionSnapshot snap)
+    {
+        EnsureSlots();
+
+        snap.epoch = s_Epoch;
+        snap.dirty = false;
+
+        ItemBase it;
+        if (s_SlotProtection != InventorySlots.INVALID)
+            it = ItemBase.Cast(player.GetInventory().FindAttachment(s_SlotProtection));
+        if (!it)
+            it = ItemBase.Cast(player.GetItemOnSlot(s_SlotProtectionName));
+
+        snap.suit = it;
+        snap.suitTier = ResolveProtectionTier(it);
+        snap.immune = false;
+        snap.suitMaxHealth = 0;
+
+        if (it)
+        {
+            snap.suitMaxHealth = it.GetMaxHealth("", "Health");
+
+            string cfgPath = "CfgVehicles " + it.GetType() + " GasImmunity";
+            if (GetGame().ConfigIsExisting(cfgPath)) { snap.immune = (GetGame().ConfigGetInt(cfgPath) == 1); }
+        }
+
+        snap.mask = null;
+        snap.maskValid = false;
+        snap.filter = null;
+
+        if (s_SlotMask != InventorySlots.INVALID)
+            snap.mask = ItemBase.Cast(player.GetInventory().FindAttachment(s_SlotMask));
+
+        if (snap.mask)
+        {
+            snap.maskValid = (snap.mask.GetHealthLevel() != GameConstants.STATE_RUINED);
+
+            if (s_SlotFilter != InventorySlots.INVALID)
+                snap.filter = ItemBase.Cast(snap.mask.GetInventory().FindAttachment(s_SlotFilter));
+            if (!snap.filter && s_SlotFilterAlt != InventorySlots.INVALID)
+                snap.filter = ItemBase.Cast(snap.mask.GetInventory().FindAttachment(s_SlotFilterAlt));
+        }
+    }
+
+    static int ResolveProtectionTier(ItemBase protectionItem)
+    {
+        if (!protectionItem) { return 0; }
+
+        NBCSuit_Base suit = NBCSuit_Base.Cast(protectionItem);
+        if (suit) { return suit.GetProtectionTier(); }
+
+        int cfgTier = TieredGasJSON.GetConfiguredProtectionTierForItem(protectionItem);
+        if (cfgTier > 0) return cfgTier;
+
+        string t = protectionItem.GetType();
+        if (t.Contains("Tier1")) return 1;
+        if (t.Contains("Tier2")) return 2;
+        if (t.Contains("Tier3")) return 3;
+        if (t.Contains("Tier4")) return 4;
+
+        return 0;
+    }
+
+    static ItemBase GetProtectionItem(PlayerBase player)
+    {
+        TieredGasProtectionSnapshot snap = GetSnapshot(player);
+        if (!snap) return null;
+        return snap.suit;
     }
 
     static void DamageProtectionItemClamped(ItemBase item, float damage)
@@ -86,15 +236,14 @@ class TieredGasProtection
 
     static float GetSuitIntegrity01(PlayerBase player)
     {
-        if (!player) return 0.0;
-
-        ItemBase protectionItem = GetProtectionItem(player);
-        if (!protectionItem) return 0.0;
+        TieredGasProtectionSnapshot snap = GetSnapshot(player);
+        if (!snap || !snap.suit) return 0.0;
 
-        float maxH = protectionItem.GetMaxHealth("", "Health");
+        float maxH = snap.suitMaxHealth;
         if (maxH <= 0) return 0.0;
 
-        float h = protectionItem.GetHealth("", "Health");
+        // Health itself changes continuously (wear), so only the item and its max are cached.
+        float h = snap.suit.GetHealth("", "Health");
         float r = h / maxH;
         if (r < 0) r = 0;
         if (r > 1) r = 1;
@@ -118,51 +267,32 @@ class TieredGasProtection
 
     static int GetPlayerProtectionTier(PlayerBase player)
     {
-        if (!player) { return 0; }
-
-        ItemBase protectionItem = GetProtectionItem(player);
-        if (!protectionItem) { return 0; }
-
-        NBCSuit_Base suit = NBCSuit_Base.Cast(protectionItem);
-        if (suit) { return suit.GetProtectionTier(); }
-
-        int cfgTier = TieredGasJSON.GetConfiguredProtectionTierForItem(protectionItem);
-        if (cfgTier > 0) return cfgTier;
-
-        string t = protectionItem.GetType();
-        if (t.Contains("Tier1")) return 1;
-        if (t.Contains("Tier2")) return 2;
-        if (t.Contains("Tier3")) return 3;
-        if (t.Contains("Tier4")) return 4;
-
-        return 0;
+        TieredGasProtectionSnapshot snap = GetSnapshot(player);
+        if (!snap) { return 0; }
+        return snap.suitTier;
     }
 
     static bool HasValidGasMask(PlayerBase player)
     {
-        ItemBase mask = ItemBase.Cast(player.FindAttachmentBySlotName("Mask"));
-        if (!mask) { return false; }
-
-        return mask.GetHealthLevel() != GameConstants.STATE_RUINED;
+        TieredGasProtectionSnapshot snap = GetSnapshot(player);
+        if (!snap) { return false; }
+        return snap.maskValid;
     }
 
     static bool HasGasImmunity(PlayerBase player)
     {
-        ItemBase protectionItem = GetProtectionItem(player);
-        if (!protectionItem) { return false; }
-
-        string cfgPath = "CfgVehicles " + protectionItem.GetType() + " GasImmunity";
-        if (GetGame().ConfigIsExisting(cfgPath)) { return GetGame().ConfigGetInt(cfgPath) == 1; }
-
-        return false;
+        TieredGasProtectionSnapshot snap = GetSnapshot(player);
+        if (!snap) { return false; }
+        return snap.immune;
     }
 
     static void ApplyGasWear(PlayerBase player, int gasTier, float deltaTime, float tierMult = 1.0)
     {
-        ItemBase protectionItem = GetProtectionItem(player);
-        if (!protectionItem) { return; }
+        TieredGasProtectionSnapshot snap = GetSnapshot(player);
+        if (!snap || !snap.suit) { return; }
 
-        int suitTier = GetPlayerProtectionTier(player);
+        ItemBase protectionItem = snap.suit;
+        int suitTier = snap.suitTier;
         if (suitTier <= 0) { return; }
         int diff = gasTier - suitTier;
         if (diff <= 0) { return; }
@@ -175,25 +305,14 @@ class TieredGasProtection
         DamageProtectionItemClamped(protectionItem, wear);
     }
 
-    static void DrainGasFilter(PlayerBase player, float deltaTime, int gasType, int gasTier)
+    static void DrainGasFilter(PlayerBase player, float deltaTime, float drainRate)
     {
-        ItemBase mask = ItemBase.Cast(player.FindAttachmentBySlotName("Mask"));
-        if (!mask) { return; }
-
-        float drainRate = TieredGasJSON.GetFilterDrain(gasType);
-
-        GasTierData tierData = TieredGasJSON.GetTier(gasTier);
-        if (tierData)
-            drainRate *= tierData.filterMultiplier;
-
-        ItemBase filter;
-        int slotFilter = InventorySlots.GetSlotIdFromString("GasMaskFilter");
-        if (slotFilter >= 0)
-            filter = ItemBase.Cast(mask.GetInventory().FindAttachment(slotFilter));
+        TieredGasProtectionSnapshot snap = GetSnapshot(player);
+        if (!snap || !snap.mask) { return; }
 
-        if (!filter)
-            filter = ItemBase.Cast(mask.FindAttachmentBySlotName("GasFilter"));
+        ItemBase mask = snap.mask;
 
+        ItemBase filter = snap.filter;
         if (filter)
         {
             if (filter.HasQuantity())
@@ -1,7 +1,7 @@
 //---------------------------------------------------------------------------------------------------
 // scripts/4_World/04_TieredGasArea.c
 //
-// File summary: Gas damage/effects application (server-side). Called from PlayerBase tick.
+// File summary: Gas damage/effects application (server-side). Dispatched per occupant by TieredGasOccupancy.
 //
 // Key behavior:
 // - "NBC suit" is a single armband item (NBCSuit_Base) providing a protection tier.
@@ -16,25 +16,28 @@ void ApplyTieredGasDamage(PlayerBase player, float deltaTime, int gasTier, int g
 {
     if (!player || !player.IsAlive()) { return; }
     if (!GetGame().IsServer()) { return; }
-    if (TieredGasProtection.HasGasImmunity(player)) { return; }
 
-    GasTypeData data = TieredGasJSON.GetGasType(TieredGasTypes.GasTypeToString(gasType));
+    TieredGasProtectionSnapshot prot = TieredGasProtection.GetSnapshot(player);
+    if (!prot || prot.immune) { return; }
+
+    TieredGasCompiledSettings settings = TieredGasJSON.GetCompiled();
+    if (!settings) { return; }
+
+    TieredGasCompiledTier data = settings.Get(gasType, gasTier);
     if (!data) { return; }
 
-    GasTierData tierData = TieredGasJSON.GetTier(gasTier);
-    float tierMult = 1.0;
-    if (tierData) { tierMult = tierData.damageMultiplier; }
+    float tierMult = data.damageMultiplier;
 
-    int suitTier = TieredGasProtection.GetPlayerProtectionTier(player);
+    int suitTier = prot.suitTier;
 
     int effectiveTier = suitTier;
-    if (maskRequired && !TieredGasProtection.HasValidGasMask(player))
+    if (maskRequired && !prot.maskValid)
         effectiveTier = 0;
 
     if (effectiveTier >= gasTier && effectiveTier > 0)
     {
         if (maskRequired)
-            TieredGasProtection.DrainGasFilter(player, deltaTime, gasType, gasTier);
+            TieredGasProtection.DrainGasFilter(player, deltaTime, data.filterDrain);
 
         return;
     }
@@ -75,14 +78,14 @@ void ApplyTieredGasDamage(PlayerBase player, float deltaTime, int gasTier, int g
         }
     }
 
-    if (maskRequired && !TieredGasProtection.HasValidGasMask(player))
+    if (maskRequired && !prot.maskValid)
         leak = 1.0;
 
     if (leak > 0.0)
     {
         float mult = tierMult * leak;
 
-        if (data.cough && TieredGasJSON.AllowsTierEffect("COUGH", gasTier))
+        if (data.Allows(TIEREDGAS_FX_COUGH))
         {
             player.TG_TryCough(gasTier, leak);
         }
@@ -92,19 +95,20 @@ void ApplyTieredGasDamage(PlayerBase player, float deltaTime, int gasTier, int g
             float stamDrain = (5.0 + (gasTier * 2.0)) * mult * deltaTime;
             player.TG_DrainStamina(stamDrain);
 
-            if (TieredGasJSON.AllowsPermanentEffect("NERVE_PERMANENT", gasTier))
+            if (data.Allows(TIEREDGAS_FX_NERVE_PERMANENT))
                 player.TG_AddNerveExposure(leak * deltaTime * (1.0 + (gasTier * 0.25)));
         }
 
         if (gasType == TieredGasType.BIO)
         {
-            if (TieredGasJSON.AllowsPermanentEffect("BIO_INFECTION", gasTier))
+            bool bioAllowed = data.Allows(TIEREDGAS_FX_BIO_INFECTION);
+            if (bioAllowed)
                 player.TG_AddBioExposure(leak * deltaTime * (1.0 + (gasTier * 0.25)));
 
-            if (TieredGasJSON.AllowsPermanentEffect("BIO_INFECTION", gasTier) && !player.TG_IsBioInfected() && player.TG_CanRollBioNow())
+            if (bioAllowed && !player.TG_IsBioInfected() && player.TG_CanRollBioNow())
             {
-                float baseInf = TieredGasJSON.GetBioInfectionChanceForTier(gasTier);
-                float capInf  = TieredGasJSON.GetBioInfectionChanceCap();
+                float baseInf = data.bioInfectionChance;
+                float capInf  = settings.bioInfectionChanceCap;
                 float infChance = baseInf * leak;
                 if (infChance > capInf) infChance = capInf;
 
@@ -118,21 +122,21 @@ void ApplyTieredGasDamage(PlayerBase player, float deltaTime, int gasTier, int g
 
         if (gasType == TieredGasType.TOXIC && player.TG_CanRollBleedNow())
         {
-            float baseChance = TieredGasJSON.GetToxicBleedChanceForTier(gasTier);
-            float capChance  = TieredGasJSON.GetToxicBleedChanceCap();
+            float baseChance = data.toxicBleedChance;
+            float capChance  = settings.toxicBleedChanceCap;
 
             float chance = baseChance * leak;
             if (chance > capChance) chance = capChance;
             bool added = player.TG_TryAddBleedCut(chance);
             if (added)
             {
-                if (TieredGasJSON.AllowsPermanentEffect("TOXIC_WOUND", gasTier))
+                if (data.Allows(TIEREDGAS_FX_TOXIC_WOUND))
                     player.TG_TryInfectToxicWound(gasTier, leak);
             }
         }
     }
 
     if (maskRequired)
-        TieredGasProtection.DrainGasFilter(player, deltaTime, gasType, gasTier);
+        TieredGasProtection.DrainGasFilter(player, deltaTime, data.filterDrain);
 
 }
@@ -45,6 +45,13 @@
 //          pos: world position
 //          maxDist: max search radius
 //
+// int FindNearestZoneIndex(vector pos, float maxDist, bool useBaseY = false)
+//      Same as above but returns the m_GasZones / s_RuntimeZones index (-1 if none).
+//      Params:
+//          pos: world position
+//          maxDist: max search radius
+//          useBaseY: compare against the zone floor instead of the stored center Y
+//
 // void ReloadConfig()
 //      Reloads TieredGas settings/config from disk.
 //      Params: none
@@ -69,6 +76,103 @@
 //      RPC handler: admin requests reloading zones.
 //      Params:
 //          sender: requesting identity
+//
+// void RebuildRuntimeZones()
+//      Compiles s_RuntimeZones (index-aligned with m_GasZones), rebuilds the spatial grid, bumps
+//      s_ZoneSetVersion so per-player zone schedules are recomputed on their next tick and records the
+//      per-record differences to the previous version in the change log.
+//      Params: none
+//
+// void GetZoneCandidates(vector pos, float pad, array<int> outIdx)
+//      Fills outIdx with s_RuntimeZones indices whose footprint cell(s) overlap pos (+/- pad).
+//      Params:
+//          pos: world position
+//          pad: extra search distance
+//          outIdx: result indices
+//
+// void NotifyZonesChanged(bool save = false)
+//      Single hook after m_GasZones was edited: recompiles runtime zones and drops occupancy of removed
+//      zones immediately, then (re)arms the quiet window after which FlushZoneChanges saves and broadcasts.
+//      Params:
+//          save: the edit must be written to GasZones.json
+//
+// void FlushZoneChanges()
+//      Writes GasZones.json if dirty and queues every player for a zone update.
+//      Params: none
+//
+// void FlushPendingSave()
+//      Writes GasZones.json now if an edit is still waiting for the quiet window (call before anything
+//      re-reads the file).
+//      Params: none
+//
+// void BroadcastZonesToAll()
+//      (Re)fills the send queue with every connected player.
+//      Params: none
+//
+// void OnUpdate(float timeslice)
+//      Server frame: drains the send queue up to zoneSyncBytesPerFrame (at least one player per frame).
+//      Params:
+//          timeslice: frame delta time (unused)
+//
+// void EnsureSyncPayload()
+//      Builds the cached sync chunks (binary or legacy JSON) + content hash if the zone set or the
+//      configured wire format changed since the last build.
+//      Params: none
+//
+// int SendZonesToPlayer(PlayerBase player)
+//      Sends the cached full sync chunks to one player (join / explicit resync request). Returns the
+//      approximate bytes sent.
+//      Params:
+//          player: recipient
+//
+// void HandleZonesRequest(PlayerBase player, bool hasHash, int clientHash)
+//      Server: join / resync request. Answers RPC_TIERED_GAS_ZONES_UNCHANGED if the client's cached hash
+//      matches the current zone set, otherwise sends the full sync.
+//      Params:
+//          player: requesting player
+//          hasHash: request carried a cached hash
+//          clientHash: hash of the client's cached zone set
+//
+// int SendZoneUpdateToPlayer(PlayerBase player)
+//      Brings one player up to the current zone set version: a delta when the player's last acknowledged
+//      version is still covered by the change log, otherwise a full sync. No-op if already current.
+//      Returns the approximate bytes sent.
+//      Params:
+//          player: recipient
+//
+// int UpdatePlayerInterest(PlayerBase player, bool force)
+//      Interest streaming (zoneInterestRadius > 0): sends the player the zones whose edge came within the
+//      interest radius and removes the ones now beyond radius + hysteresis (RPC_TIERED_GAS_ZONES_INTEREST).
+//      Only re-evaluates after the player moved half the hysteresis or the zone set changed, unless forced.
+//      Returns the approximate bytes sent.
+//      Params:
+//          player: recipient
+//          force: re-evaluate regardless of movement
+//
+// TieredGasZoneDelta GetZoneDelta(int fromVersion)
+//      Returns the (cached) delta from fromVersion to the current version, or null if the change log no
+//      longer covers it or the delta would not be smaller than a full sync.
+//      Params:
+//          fromVersion: version the recipient currently holds
+//
+// void ApplyClientZoneSync(array<ref GasZoneConfig> zones)
+//      Client: makes the local zone set equal to zones. Map-based diff: removes zones not in the set, then
+//      adds / updates the rest, skipping records whose content hash matches what is already applied.
+//      Params:
+//          zones: complete zone set
+//
+// void ApplyClientZoneDelta(array<ref GasZoneConfig> upserts, array<string> removals)
+//      Client: applies a delta on top of the current local zone set.
+//      Params:
+//          upserts: added / modified zones
+//          removals: removed zone UUIDs
+//
+// void BenchmarkZoneQueries(array<vector> samples, int iterations, array<string> outLines)
+//      Times brute-force vs indexed containment queries over sample positions.
+//      Params:
+//          samples: query positions
+//          iterations: passes over the sample set
+//          outLines: human-readable report
 //---------------------------------------------------------------------------------------------------
 
 class TieredGasZoneSpawner
@@ -76,8 +180,39 @@ class TieredGasZoneSpawner
     static ref array<ref GasZoneConfig> m_GasZones;
     static ref map<string, TieredGasZone> m_ClientZonesByUUID;
     static ref map<string, ref GasZoneConfig> m_ClientConfigsByUUID;
+    static ref map<string, int> m_ClientHashesByUUID;
     static const int ZONES_RPC_CHUNK_SIZE = 900;
 
+    static ref array<ref TieredGasRuntimeZone> s_RuntimeZones;
+    static ref TieredGasZoneIndex s_ZoneIndex;
+    static int s_ZoneSetVersion;
+
+    // Serialized zone sync, built once per zone set version and shared by every recipient.
+    // Binary chunks (default) or legacy JSON chunks, depending on GasSettings zoneSyncFormat.
+    static ref array<ref Param3<int, int, string>> s_SyncChunks;
+    static ref array<ref TieredGasZoneSyncChunk> s_SyncBinChunks;
+    static bool s_SyncBinary;
+    static int s_SyncPayloadVersion = -1;
+    static int s_SyncBytes;
+    static int s_SyncHash;
+
+    // Change log for delta sync: one entry per zone set version, the oldest dropped past
+    // ZONE_CHANGELOG_MAX. Players further behind than the log get a full sync.
+    static const int ZONE_CHANGELOG_MAX = 32;
+    static ref map<string, int> s_ZoneRecordHashes;
+    static ref array<ref TieredGasZoneChange> s_ZoneChangeLog;
+    static ref map<int, ref TieredGasZoneDelta> s_DeltaCache;
+
+    // Coalesced broadcasts: edits only mark these; FlushZoneChanges runs after the quiet window and the
+    // send queue is drained by OnUpdate under a per-frame byte budget.
+    static bool s_ZonesSaveDirty;
+    static bool s_BroadcastPending;
+    static ref array<PlayerBase> s_SendQueue;
+    static int s_SendCursor;
+
+    // Client: zone set version currently applied (-1 = unknown / legacy JSON sync).
+    static int s_ClientZoneVersion = -1;
+
     static void Init()
     {
         if (GetGame().IsServer())
@@ -92,10 +227,12 @@ class TieredGasZoneSpawner
             }
 
             UpgradeZonesIfNeeded();
+            RebuildRuntimeZones();
             return;
         }
         if (!m_ClientZonesByUUID) { m_ClientZonesByUUID = new map<string, TieredGasZone>; }
         if (!m_ClientConfigsByUUID) { m_ClientConfigsByUUID = new map<string, ref GasZoneConfig>; }
+        if (!m_ClientHashesByUUID) { m_ClientHashesByUUID = new map<string, int>; }
     }
 
     static void UpgradeZonesIfNeeded()
@@ -129,6 +266,152 @@ class TieredGasZoneSpawner
         }
     }
 
+    static void RebuildRuntimeZones()
+    {
+        if (!s_RuntimeZones) { s_RuntimeZones = new array<ref TieredGasRuntimeZone>; }
+        if (!s_ZoneIndex) { s_ZoneIndex = new TieredGasZoneIndex(); }
+
+        s_RuntimeZones.Clear();
+        s_ZoneIndex.Clear();
+        s_ZoneSetVersion++;
+
+        if (!m_GasZones) { return; }
+
+        for (int i = 0; i < m_GasZones.Count(); i++)
+        {
+            // Kept index-aligned with m_GasZones (null slots stay null) so index ids address both arrays.
+            TieredGasRuntimeZone rz = TieredGasRuntimeZone.Compile(m_GasZones[i]);
+            s_RuntimeZones.Insert(rz);
+
+            if (rz) { s_ZoneIndex.Insert(i, rz.center, rz.radius); }
+        }
+
+        RecordZoneChanges();
+    }
+
+    protected static void RecordZoneChanges()
+    {
+        map<string, int> hashes = new map<string, int>;
+        if (m_GasZones)
+        {
+            foreach (GasZoneConfig cfg : m_GasZones)
+            {
+                if (cfg && cfg.uuid != "") hashes.Set(cfg.uuid, TieredGasZoneSyncCodec.HashZone(cfg));
+            }
+        }
+
+        // First build only seeds the hashes; nobody can hold an older version yet.
+        if (s_ZoneRecordHashes)
+        {
+            if (!s_ZoneChangeLog) { s_ZoneChangeLog = new array<ref TieredGasZoneChange>; }
+
+            TieredGasZoneChange change = new TieredGasZoneChange(s_ZoneSetVersion);
+            int oldHash;
+            foreach (string uuid, int h : hashes)
+            {
+                if (!s_ZoneRecordHashes.Find(uuid, oldHash) || oldHash != h)
+                    change.upserts.Insert(uuid);
+            }
+            foreach (string oldUUID, int oh : s_ZoneRecordHashes)
+            {
+                if (!hashes.Contains(oldUUID))
+                    change.removals.Insert(oldUUID);
+            }
+
+            s_ZoneChangeLog.Insert(change);
+            while (s_ZoneChangeLog.Count() > ZONE_CHANGELOG_MAX)
+                s_ZoneChangeLog.RemoveOrdered(0);
+        }
+
+        s_ZoneRecordHashes = hashes;
+    }
+
+    static void GetZoneCandidates(vector pos, float pad, notnull array<int> outIdx)
+    {
+        if (!s_ZoneIndex || !s_RuntimeZones) { RebuildRuntimeZones(); }
+        s_ZoneIndex.Query(pos, pad, outIdx);
+    }
+
+    static void NotifyZonesChanged(bool save = false)
+    {
+        if (!GetGame().IsServer()) { return; }
+
+        // Server-side containment sees the edit immediately; the file write and client sync wait for the
+        // quiet window so a burst of admin edits costs one save and one broadcast.
+        RebuildRuntimeZones();
+        TieredGasOccupancy.PruneZones();
+
+        if (save) { s_ZonesSaveDirty = true; }
+        s_BroadcastPending = true;
+
+        ScriptCallQueue queue = GetGame().GetCallQueue(CALL_CATEGORY_GAMEPLAY);
+        queue.Remove(FlushZoneChanges);
+        queue.CallLater(FlushZoneChanges, TieredGasJSON.GetZoneBroadcastQuietMS(), false);
+    }
+
+    static void BenchmarkZoneQueries(array<vector> samples, int iterations, notnull array<string> outLines)
+    {
+        outLines.Clear();
+
+        if (!m_GasZones || m_GasZones.Count() == 0 || !samples || samples.Count() == 0)
+        {
+            outLines.Insert("[TieredGas] Benchmark: nothing to query (zones=0 or no sample positions)");
+            return;
+        }
+
+        if (iterations < 1) { iterations = 1; }
+        if (!s_ZoneIndex || !s_RuntimeZones) { RebuildRuntimeZones(); }
+
+        int hitsBrute = 0;
+        int testsBrute = 0;
+        int t0 = TickCount(0);
+
+        for (int it = 0; it < iterations; it++)
+        {
+            foreach (vector sb : samples)
+            {
+                foreach (TieredGasRuntimeZone rzB : s_RuntimeZones)
+                {
+                    if (!rzB) { continue; }
+                    testsBrute++;
+                    if (rzB.Contains(sb)) { hitsBrute++; }
+                }
+            }
+        }
+
+        int ticksBrute = TickCount(t0);
+
+        int hitsIndexed = 0;
+        int testsIndexed = 0;
+        array<int> candidates = new array<int>;
+        int t1 = TickCount(0);
+
+        for (int jt = 0; jt < iterations; jt++)
+        {
+            foreach (vector si : samples)
+            {
+                s_ZoneIndex.Query(si, 0, candidates);
+                foreach (int zi : candidates)
+                {
+                    testsIndexed++;
+                    if (s_RuntimeZones[zi].Contains(si)) { hitsIndexed++; }
+                }
+            }
+        }
+
+        int ticksIndexed = TickCount(t1);
+
+        int queries = iterations * samples.Count();
+        outLines.Insert("[TieredGas] Benchmark: zones=" + m_GasZones.Count() + " samples=" + samples.Count() + " iterations=" + iterations + " cell=" + s_ZoneIndex.GetCellSize());
+        outLines.Insert("[TieredGas]  brute:   ticks=" + ticksBrute + " tests=" + testsBrute + " hits=" + hitsBrute + " ticks/query=" + (ticksBrute / (float)queries));
+        outLines.Insert("[TieredGas]  indexed: ticks=" + ticksIndexed + " tests=" + testsIndexed + " hits=" + hitsIndexed + " ticks/query=" + (ticksIndexed / (float)queries));
+
+        if (hitsBrute != hitsIndexed)
+        {
+            outLines.Insert("[TieredGas]  WARNING: indexed result mismatch (" + hitsIndexed + " vs " + hitsBrute + ")");
+        }
+    }
+
     static vector ParsePositionString(string posStr)
     {
         vector result = "0 0 0";
@@ -153,36 +436,295 @@ class TieredGasZoneSpawner
         }
         else
         {
-            Print("[TieredGas] ERROR: Invalid position string: " + posStr);
+            TieredGasLog.Limited(TieredGasLogLevel.ERROR, "ParsePositionString", "[TieredGas] ERROR: Invalid position string: " + posStr);
         }
 
         return result;
     }
 
-    static void SendZonesToPlayer(PlayerBase player)
+    static void EnsureSyncPayload()
     {
-        if (!GetGame().IsServer() || !player || !player.GetIdentity()) return;
+        bool binary = TieredGasJSON.UseBinaryZoneSync();
+        if (s_SyncPayloadVersion == s_ZoneSetVersion && s_SyncBinary == binary) return;
 
         UpgradeZonesIfNeeded();
 
-        string jsonStr;
-        array<string> chunks;
-        TieredGasJSON.ZonesToChunks(m_GasZones, ZONES_RPC_CHUNK_SIZE, chunks, jsonStr);
+        s_SyncChunks = null;
+        s_SyncBinChunks = null;
+        s_DeltaCache = null;
+        s_SyncBinary = binary;
+        s_SyncHash = TieredGasZoneSyncCodec.HashZones(m_GasZones);
+        s_SyncPayloadVersion = s_ZoneSetVersion;
 
-        int len = jsonStr.Length();
-        int total = chunks.Count();
+        int total;
+        if (binary)
+        {
+            s_SyncBinChunks = new array<ref TieredGasZoneSyncChunk>;
+            TieredGasZoneSyncCodec.BuildChunks(m_GasZones, s_SyncBinChunks);
+            total = s_SyncBinChunks.Count();
+            s_SyncBytes = 0;
+            foreach (TieredGasZoneSyncChunk bc : s_SyncBinChunks)
+                s_SyncBytes += bc.EstimateBytes();
+        }
+        else
+        {
+            string jsonStr;
+            array<string> chunks;
+            TieredGasJSON.ZonesToChunks(m_GasZones, ZONES_RPC_CHUNK_SIZE, chunks, jsonStr);
 
-        for (int i = 0; i < total; i++)
+            total = chunks.Count();
+            s_SyncChunks = new array<ref Param3<int, int, string>>;
+            for (int i = 0; i < total; i++)
+            {
+                s_SyncChunks.Insert(new Param3<int, int, string>(i, total, chunks[i]));
+            }
+            s_SyncBytes = jsonStr.Length();
+        }
+
+        if (TieredGasLog.IsEnabled(TieredGasLogLevel.DEBUG))
+            TieredGasLog.LogDebug("[TieredGas] Zone sync payload rebuilt -> version=" + s_SyncPayloadVersion + " binary=" + binary + " chunks=" + total + " bytes=" + s_SyncBytes + " hash=" + s_SyncHash);
+    }
+
+    static TieredGasZoneDelta GetZoneDelta(int fromVersion)
+    {
+        if (fromVersion < 0 || fromVersion >= s_SyncPayloadVersion || !s_ZoneChangeLog) return null;
+
+        TieredGasZoneDelta delta;
+        if (!s_DeltaCache) { s_DeltaCache = new map<int, ref TieredGasZoneDelta>; }
+        if (s_DeltaCache.Find(fromVersion, delta)) return delta;
+
+        // The log must hold every version in (fromVersion, current]; entries are consecutive, so it is
+        // enough that the oldest one is not newer than fromVersion + 1.
+        int logCount = s_ZoneChangeLog.Count();
+        if (logCount == 0 || s_ZoneChangeLog[0].version > fromVersion + 1) return null;
+        if (s_ZoneChangeLog[logCount - 1].version != s_SyncPayloadVersion) return null;
+
+        // Replay in order; a later op on the same UUID overrides an earlier one.
+        map<string, bool> ops = new map<string, bool>; // uuid -> true = upsert, false = removal
+        foreach (TieredGasZoneChange change : s_ZoneChangeLog)
         {
-            string chunk = chunks[i];
+            if (change.version <= fromVersion) continue;
+            foreach (string up : change.upserts) ops.Set(up, true);
+            foreach (string rm : change.removals) ops.Set(rm, false);
+        }
 
-            Param3<int, int, string> p = new Param3<int, int, string>(i, total, chunk);
-            GetGame().RPCSingleParam(player, RPC_TIERED_GAS_ZONES_SYNC, p, true, player.GetIdentity());
+        // Not worth it past one chunk of records; the full payload is already cached.
+        if (ops.Count() > TieredGasZoneSyncCodec.RECORDS_PER_CHUNK) return null;
 
-            Print("[TieredGas] ZONES_SYNC chunk " + i + "/" + total + " len=" + chunk.Length().ToString());
+        array<ref GasZoneConfig> upserts = new array<ref GasZoneConfig>;
+        delta = new TieredGasZoneDelta();
+        delta.fromVersion = fromVersion;
+        delta.toVersion = s_SyncPayloadVersion;
+        delta.hash = s_SyncHash;
+
+        foreach (GasZoneConfig cfg : m_GasZones)
+        {
+            bool isUpsert;
+            if (cfg && ops.Find(cfg.uuid, isUpsert) && isUpsert) upserts.Insert(cfg);
+        }
+        foreach (string uuid, bool upsert : ops)
+        {
+            if (!upsert) delta.removals.Insert(uuid);
         }
 
-        Print("[TieredGas] SendZonesToPlayer -> chunks=" + total + " bytes=" + len);
+        array<ref TieredGasZoneSyncChunk> chunks = new array<ref TieredGasZoneSyncChunk>;
+        TieredGasZoneSyncCodec.BuildChunks(upserts, chunks);
+        delta.upserts = chunks[0];
+
+        s_DeltaCache.Set(fromVersion, delta);
+        return delta;
+    }
+
+    static void HandleZonesRequest(PlayerBase player, bool hasHash, int clientHash)
+    {
+        if (!GetGame().IsServer() || !player || !player.GetIdentity()) return;
+
+        if (TieredGasJSON.GetZoneInterestRadius() > 0)
+        {
+            player.m_TG_InterestZones = null;
+            UpdatePlayerInterest(player, true);
+            return;
+        }
+
+        EnsureSyncPayload();
+
+        if (!hasHash || clientHash != s_SyncHash)
+        {
+            SendZonesToPlayer(player);
+            return;
+        }
+
+        int version = -1;
+        if (s_SyncBinary) version = s_SyncPayloadVersion;
+        player.m_TG_ZoneSyncVersion = version;
+
+        GetGame().RPCSingleParam(player, RPC_TIERED_GAS_ZONES_UNCHANGED, new Param2<int, int>(version, s_SyncHash), true, player.GetIdentity());
+
+        if (TieredGasLog.IsEnabled(TieredGasLogLevel.DEBUG))
+            TieredGasLog.LogDebug("[TieredGas] Zone request: client cache current (hash=" + s_SyncHash + ")");
+    }
+
+    static int UpdatePlayerInterest(PlayerBase player, bool force)
+    {
+        if (!GetGame().IsServer() || !player || !player.GetIdentity()) return 0;
+
+        float radius = TieredGasJSON.GetZoneInterestRadius();
+        if (radius <= 0) return 0;
+
+        float hyst = TieredGasJSON.GetZoneInterestHysteresis();
+        float keep = radius + hyst;
+        vector pos = player.GetPosition();
+        bool reset = !player.m_TG_InterestZones;
+
+        if (!force && !reset && player.m_TG_InterestVersion == s_ZoneSetVersion)
+        {
+            float step = hyst * 0.5;
+            if (vector.DistanceSq(pos, player.m_TG_InterestPos) < step * step) return 0;
+        }
+
+        if (!s_ZoneIndex || !s_RuntimeZones) { RebuildRuntimeZones(); }
+
+        player.m_TG_InterestPos = pos;
+        player.m_TG_InterestVersion = s_ZoneSetVersion;
+
+        map<string, int> current = player.m_TG_InterestZones;
+        if (!current) current = new map<string, int>;
+        map<string, int> next = new map<string, int>;
+
+        array<int> candidates = new array<int>;
+        s_ZoneIndex.Query(pos, keep, candidates);
+
+        // uuid -> record hash the client holds; a changed hash means the zone was edited and is resent.
+        array<ref GasZoneConfig> upserts = new array<ref GasZoneConfig>;
+        foreach (int idx : candidates)
+        {
+            TieredGasRuntimeZone rz = s_RuntimeZones[idx];
+            if (!rz) continue;
+
+            float dx = rz.center[0] - pos[0];
+            float dz = rz.center[2] - pos[2];
+            float edge = Math.Sqrt((dx * dx) + (dz * dz)) - rz.radius;
+
+            int sentHash;
+            bool had = current.Find(rz.uuid, sentHash);
+            if (edge > keep) continue;
+            if (!had && edge > radius) continue;
+
+            int h = s_ZoneRecordHashes.Get(rz.uuid);
+            next.Set(rz.uuid, h);
+            if (!had || sentHash != h) upserts.Insert(m_GasZones[idx]);
+        }
+
+        array<string> removals = new array<string>;
+        foreach (string uuid, int oldHash : current)
+        {
+            if (!next.Contains(uuid)) removals.Insert(uuid);
+        }
+
+        player.m_TG_InterestZones = next;
+        player.m_TG_ZoneSyncVersion = -1;
+
+        if (!reset && upserts.Count() == 0 && removals.Count() == 0) return 0;
+
+        int bytes = 0;
+        array<ref TieredGasZoneSyncChunk> chunks = new array<ref TieredGasZoneSyncChunk>;
+        TieredGasZoneSyncCodec.BuildChunks(upserts, chunks);
+
+        for (int i = 0; i < chunks.Count(); i++)
+        {
+            TieredGasZoneDelta delta = new TieredGasZoneDelta();
+            delta.fromVersion = -1;
+            delta.toVersion = s_ZoneSetVersion;
+            delta.upserts = chunks[i];
+            if (i == 0) delta.removals = removals;
+
+            // reset: first batch after join / respawn replaces whatever the client still shows
+            bool resetBatch = reset && i == 0;
+            ScriptRPC rpc = new ScriptRPC();
+            rpc.Write(resetBatch);
+            delta.Write(rpc);
+            bytes += 4 + delta.EstimateBytes();
+            rpc.Send(player, RPC_TIERED_GAS_ZONES_INTEREST, true, player.GetIdentity());
+        }
+
+        if (TieredGasLog.IsEnabled(TieredGasLogLevel.DEBUG))
+            TieredGasLog.LogDebug("[TieredGas] Zone interest -> +" + upserts.Count() + " -" + removals.Count() + " (holding " + next.Count() + ", reset=" + reset + ")");
+
+        return bytes;
+    }
+
+    static int SendZoneUpdateToPlayer(PlayerBase player)
+    {
+        if (!GetGame().IsServer() || !player || !player.GetIdentity()) return 0;
+
+        if (TieredGasJSON.GetZoneInterestRadius() > 0)
+        {
+            return UpdatePlayerInterest(player, true);
+        }
+
+        EnsureSyncPayload();
+
+        if (s_SyncBinary && player.m_TG_ZoneSyncVersion >= 0)
+        {
+            if (player.m_TG_ZoneSyncVersion == s_SyncPayloadVersion) return 0;
+
+            TieredGasZoneDelta delta = GetZoneDelta(player.m_TG_ZoneSyncVersion);
+            if (delta)
+            {
+                ScriptRPC rpc = new ScriptRPC();
+                delta.Write(rpc);
+                rpc.Send(player, RPC_TIERED_GAS_ZONES_DELTA, true, player.GetIdentity());
+                player.m_TG_ZoneSyncVersion = s_SyncPayloadVersion;
+
+                if (TieredGasLog.IsEnabled(TieredGasLogLevel.DEBUG))
+                    TieredGasLog.LogDebug("[TieredGas] Zone delta " + delta.fromVersion + " -> " + delta.toVersion + " removals=" + delta.removals.Count());
+                return delta.EstimateBytes();
+            }
+        }
+
+        return SendZonesToPlayer(player);
+    }
+
+    static int SendZonesToPlayer(PlayerBase player)
+    {
+        if (!GetGame().IsServer() || !player || !player.GetIdentity()) return 0;
+
+        EnsureSyncPayload();
+
+        PlayerIdentity identity = player.GetIdentity();
+        int total;
+        int i;
+
+        player.m_TG_InterestZones = null;
+
+        if (s_SyncBinary)
+        {
+            total = s_SyncBinChunks.Count();
+            for (i = 0; i < total; i++)
+            {
+                ScriptRPC rpc = new ScriptRPC();
+                s_SyncBinChunks[i].Write(rpc, s_SyncPayloadVersion, s_SyncHash, total);
+                rpc.Send(player, RPC_TIERED_GAS_ZONES_SYNC_BIN, true, identity);
+            }
+            player.m_TG_ZoneSyncVersion = s_SyncPayloadVersion;
+        }
+        else
+        {
+            total = s_SyncChunks.Count();
+            for (i = 0; i < total; i++)
+            {
+                GetGame().RPCSingleParam(player, RPC_TIERED_GAS_ZONES_SYNC, s_SyncChunks[i], true, identity);
+
+                if (TieredGasLog.IsEnabled(TieredGasLogLevel.TRACE))
+                    TieredGasLog.LogTrace("[TieredGas] ZONES_SYNC chunk " + i + "/" + total + " len=" + s_SyncChunks[i].param3.Length().ToString());
+            }
+            player.m_TG_ZoneSyncVersion = -1;
+        }
+
+        if (TieredGasLog.IsEnabled(TieredGasLogLevel.DEBUG))
+            TieredGasLog.LogDebug("[TieredGas] SendZonesToPlayer -> chunks=" + total + " binary=" + s_SyncBinary);
+
+        return s_SyncBytes;
     }
 
     static void BroadcastZonesToAll()
@@ -192,22 +734,62 @@ class TieredGasZoneSpawner
         array<Man> players = new array<Man>;
         GetGame().GetPlayers(players);
 
+        // Restart the queue: players already sent this round are brought to the newest version again
+        // (a no-op when they are current).
+        s_SendQueue = new array<PlayerBase>;
+        s_SendCursor = 0;
+
         foreach (Man m : players)
         {
             PlayerBase p = PlayerBase.Cast(m);
-            if (p) { SendZonesToPlayer(p); }
+            if (p) { s_SendQueue.Insert(p); }
         }
     }
 
-    static bool ArrayContainsString(array<string> arr, string value)
+    static void FlushZoneChanges()
     {
-        if (!arr) return false;
-        for (int i = 0; i < arr.Count(); i++)
+        if (!GetGame().IsServer()) { return; }
+
+        FlushPendingSave();
+
+        if (s_BroadcastPending)
         {
-            if (arr[i] == value)
-                return true;
+            s_BroadcastPending = false;
+            BroadcastZonesToAll();
+        }
+    }
+
+    static void FlushPendingSave()
+    {
+        if (!s_ZonesSaveDirty) { return; }
+
+        s_ZonesSaveDirty = false;
+        if (m_GasZones) TieredGasJSON.SaveZonesToJSON(m_GasZones);
+    }
+
+    static void OnUpdate(float timeslice)
+    {
+        if (!s_SendQueue) { return; }
+
+        int budget = TieredGasJSON.GetZoneSyncBytesPerFrame();
+        int sent = 0;
+
+        // At least one player per frame, even if a single full sync exceeds the budget.
+        while (s_SendCursor < s_SendQueue.Count() && sent < budget)
+        {
+            PlayerBase p = s_SendQueue[s_SendCursor];
+            s_SendCursor++;
+            if (p) { sent += SendZoneUpdateToPlayer(p); }
+        }
+
+        if (TieredGasLog.IsEnabled(TieredGasLogLevel.TRACE))
+            TieredGasLog.LogTrace("[TieredGas] Zone send queue " + s_SendCursor + "/" + s_SendQueue.Count() + " bytes=" + sent);
+
+        if (s_SendCursor >= s_SendQueue.Count())
+        {
+            s_SendQueue = null;
+            s_SendCursor = 0;
         }
-        return false;
     }
 
     static void ApplyClientZoneSync(array<ref GasZoneConfig> zones)
@@ -216,72 +798,107 @@ class TieredGasZoneSpawner
 
         if (!m_ClientZonesByUUID) { m_ClientZonesByUUID = new map<string, TieredGasZone>; }
         if (!m_ClientConfigsByUUID) { m_ClientConfigsByUUID = new map<string, ref GasZoneConfig>; }
+        if (!m_ClientHashesByUUID) { m_ClientHashesByUUID = new map<string, int>; }
 
         if (!zones)
         {
             return;
         }
 
-        ref array<string> incomingUUIDs = new array<string>();
-        for (int zi = 0; zi < zones.Count(); zi++)
+        // Incoming set (last record wins on duplicate UUIDs)
+        map<string, GasZoneConfig> incoming = new map<string, GasZoneConfig>;
+        foreach (GasZoneConfig cfgIn : zones)
         {
-            GasZoneConfig cfgIn = zones[zi];
             if (!cfgIn) continue;
             if (cfgIn.uuid == "") continue;
-
-            if (!ArrayContainsString(incomingUUIDs, cfgIn.uuid))
-                incomingUUIDs.Insert(cfgIn.uuid);
+            incoming.Set(cfgIn.uuid, cfgIn);
         }
 
-        ref array<string> toDelete = new array<string>();
+        // Remove phase
+        array<string> toDelete = new array<string>;
         foreach (string uuidOld, TieredGasZone zoneOld : m_ClientZonesByUUID)
         {
-            if (!ArrayContainsString(incomingUUIDs, uuidOld))
-            {
-                toDelete.Insert(uuidOld);
-            }
+            if (!incoming.Contains(uuidOld)) toDelete.Insert(uuidOld);
         }
 
-        for (int di = 0; di < toDelete.Count(); di++)
+        foreach (string delUUID : toDelete)
         {
-            string delUuid = toDelete[di];
-            TieredGasZone delZone = m_ClientZonesByUUID.Get(delUuid);
-            if (delZone)
-            {
-                GetGame().ObjectDelete(delZone);
-            }
-            m_ClientZonesByUUID.Remove(delUuid);
-            if (m_ClientConfigsByUUID) m_ClientConfigsByUUID.Remove(delUuid);
+            RemoveClientZone(delUUID);
         }
 
-        for (int ui = 0; ui < zones.Count(); ui++)
+        // Add / update phase (unchanged records are skipped inside)
+        int skipped = 0;
+        foreach (string uuid, GasZoneConfig cfg : incoming)
         {
-            GasZoneConfig cfg = zones[ui];
-            if (!cfg) continue;
-            if (cfg.uuid == "") continue;
-            if (cfg.name == "") cfg.name = "Gas Zone";
+            if (!ApplyClientZoneConfig(cfg)) skipped++;
+        }
 
-            m_ClientConfigsByUUID.Set(cfg.uuid, cfg);
+        if (TieredGasLog.IsEnabled(TieredGasLogLevel.DEBUG))
+            TieredGasLog.LogDebug("[TieredGas] ApplyClientZoneSync -> zones=" + incoming.Count() + " removed=" + toDelete.Count() + " unchanged=" + skipped);
+    }
 
-            TieredGasZone zone = null;
-            if (m_ClientZonesByUUID.Contains(cfg.uuid))
-            {
-                zone = m_ClientZonesByUUID.Get(cfg.uuid);
-            }
+    static void ApplyClientZoneDelta(array<ref GasZoneConfig> upserts, array<string> removals)
+    {
+        if (GetGame().IsServer()) { return; }
 
-            vector pos = ParsePositionString(cfg.position);
-            pos[1] = GetGame().SurfaceY(pos[0], pos[2]);
+        if (!m_ClientZonesByUUID) { m_ClientZonesByUUID = new map<string, TieredGasZone>; }
+        if (!m_ClientConfigsByUUID) { m_ClientConfigsByUUID = new map<string, ref GasZoneConfig>; }
 
-            if (!zone)
-            {
-                zone = TieredGasZone.Cast(GetGame().CreateObjectEx("TieredGasZone", pos, ECE_LOCAL));
-                if (!zone) continue;
-                m_ClientZonesByUUID.Set(cfg.uuid, zone);
-            }
+        if (removals)
+        {
+            foreach (string uuid : removals) RemoveClientZone(uuid);
+        }
+
+        if (!m_ClientHashesByUUID) { m_ClientHashesByUUID = new map<string, int>; }
+
+        if (upserts)
+        {
+            foreach (GasZoneConfig cfg : upserts) ApplyClientZoneConfig(cfg);
+        }
+    }
+
+    protected static void RemoveClientZone(string uuid)
+    {
+        TieredGasZone zone = m_ClientZonesByUUID.Get(uuid);
+        if (zone)
+        {
+            GetGame().ObjectDelete(zone);
+        }
+        m_ClientZonesByUUID.Remove(uuid);
+        if (m_ClientConfigsByUUID) m_ClientConfigsByUUID.Remove(uuid);
+        if (m_ClientHashesByUUID) m_ClientHashesByUUID.Remove(uuid);
+    }
+
+    // Returns false if the record was already applied unchanged (no zone work done).
+    protected static bool ApplyClientZoneConfig(GasZoneConfig cfg)
+    {
+        if (!cfg) return false;
+        if (cfg.uuid == "") return false;
+        if (cfg.name == "") cfg.name = "Gas Zone";
+
+        int hash = TieredGasZoneSyncCodec.HashZone(cfg);
+
+        TieredGasZone zone = m_ClientZonesByUUID.Get(cfg.uuid);
+        int oldHash;
+        if (zone && m_ClientConfigsByUUID.Contains(cfg.uuid) && m_ClientHashesByUUID.Find(cfg.uuid, oldHash) && oldHash == hash)
+            return false;
 
-            zone.SetPosition(pos);
-            zone.ApplyConfig(cfg.uuid, cfg.name, cfg.colorId, cfg.density, cfg.tier, cfg.gasType, cfg.radius, cfg.maskRequired, cfg.height, cfg.bottomOffset, cfg.verticalMargin, cfg.isDynamic);
+        m_ClientConfigsByUUID.Set(cfg.uuid, cfg);
+        m_ClientHashesByUUID.Set(cfg.uuid, hash);
+
+        vector pos = ParsePositionString(cfg.position);
+        pos[1] = GetGame().SurfaceY(pos[0], pos[2]);
+
+        if (!zone)
+        {
+            zone = TieredGasZone.Cast(GetGame().CreateObjectEx("TieredGasZone", pos, ECE_LOCAL));
+            if (!zone) return true;
+            m_ClientZonesByUUID.Set(cfg.uuid, zone);
         }
+
+        zone.SetZonePosition(pos);
+        zone.ApplyConfig(cfg.uuid, cfg.name, cfg.colorId, cfg.density, cfg.tier, cfg.gasType, cfg.radius, cfg.maskRequired, cfg.height, cfg.bottomOffset, cfg.verticalMargin, cfg.isDynamic);
+        return true;
     }
 
     static void AddZoneAndSave(GasZoneConfig cfg)
@@ -293,8 +910,7 @@ class TieredGasZoneSpawner
         if (cfg.name == "") { cfg.name = "Gas Zone"; }
 
         m_GasZones.Insert(cfg);
-        TieredGasJSON.SaveZonesToJSON(m_GasZones);
-        BroadcastZonesToAll();
+        NotifyZonesChanged(true);
     }
 
     static bool RemoveZoneByUUID(string uuid)
@@ -307,8 +923,7 @@ class TieredGasZoneSpawner
             if (m_GasZones[i] && m_GasZones[i].uuid == uuid)
             {
                 m_GasZones.Remove(i);
-                TieredGasJSON.SaveZonesToJSON(m_GasZones);
-                BroadcastZonesToAll();
+                NotifyZonesChanged(true);
                 return true;
             }
         }
@@ -318,26 +933,36 @@ class TieredGasZoneSpawner
 
     static GasZoneConfig FindNearestZoneConfig(vector pos, float maxDist)
     {
-        if (!m_GasZones) { return null; }
+        int idx = FindNearestZoneIndex(pos, maxDist);
+        if (idx < 0) { return null; }
+        return m_GasZones[idx];
+    }
+
+    static int FindNearestZoneIndex(vector pos, float maxDist, bool useBaseY = false)
+    {
+        if (!m_GasZones) { return -1; }
+        if (!s_RuntimeZones) { RebuildRuntimeZones(); }
 
         float best = maxDist * maxDist;
-        GasZoneConfig bestCfg;
+        int bestIdx = -1;
 
-        foreach (GasZoneConfig cfg : m_GasZones)
+        for (int i = 0; i < s_RuntimeZones.Count(); i++)
         {
-            if (!cfg) { continue; }
+            TieredGasRuntimeZone rz = s_RuntimeZones[i];
+            if (!rz) { continue; }
 
-            vector zpos = ParsePositionString(cfg.position);
-            float d2 = vector.DistanceSq(pos, zpos);
+            vector zpos = rz.center;
+            if (useBaseY) { zpos[1] = rz.GetBaseY(); }
 
+            float d2 = vector.DistanceSq(pos, zpos);
             if (d2 < best)
             {
                 best = d2;
-                bestCfg = cfg;
+                bestIdx = i;
             }
         }
 
-        return bestCfg;
+        return bestIdx;
     }
 
     static void CreateDefaultZones()
@@ -369,10 +994,26 @@ class TieredGasZoneSpawner
     {
         if (GetGame().IsServer())
         {
+            GetGame().GetCallQueue(CALL_CATEGORY_GAMEPLAY).Remove(FlushZoneChanges);
+            FlushPendingSave();
+            s_BroadcastPending = false;
+            s_SendQueue = null;
+            s_SendCursor = 0;
+
             if (m_GasZones) m_GasZones.Clear();
+            if (s_RuntimeZones) s_RuntimeZones.Clear();
+            if (s_ZoneIndex) s_ZoneIndex.Clear();
+            s_SyncChunks = null;
+            s_SyncBinChunks = null;
+            s_SyncPayloadVersion = -1;
+            s_ZoneRecordHashes = null;
+            s_ZoneChangeLog = null;
+            s_DeltaCache = null;
             return;
         }
 
+        s_ClientZoneVersion = -1;
+
         if (m_ClientZonesByUUID)
         {
             foreach (string k, TieredGasZone z : m_ClientZonesByUUID)
@@ -386,5 +1027,10 @@ class TieredGasZoneSpawner
         {
             m_ClientConfigsByUUID.Clear();
         }
+
+        if (m_ClientHashesByUUID)
+        {
+            m_ClientHashesByUUID.Clear();
+        }
     }
 };
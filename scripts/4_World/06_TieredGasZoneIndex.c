@@ -0,0 +1,142 @@
+//---------------------------------------------------------------------------------------------------
+// scripts/4_World/06_TieredGasZoneIndex.c
+//
+// File summary: Uniform 2D grid over zone footprints (XZ plane). Each zone id is stored in every cell its
+//               bounding square touches, so a point query only has to test the zones of one cell.
+//
+// TieredGasZoneIndex
+//
+// void Clear()
+//      Drops every cell (keeps the configured cell size).
+//      Params: none
+//
+// void Insert(int id, vector center, float radius)
+//      Registers a zone footprint under a caller-defined id (usually the index into the zone array).
+//      Params:
+//          id: zone id (>= 0)
+//          center: zone center (Y ignored)
+//          radius: horizontal radius
+//
+// void Query(vector pos, float pad, array<int> outIds)
+//      Collects ids of zones whose footprint cells overlap the square pos +/- pad (deduplicated).
+//      Params:
+//          pos: query position (Y ignored)
+//          pad: extra search distance around pos (0 = single cell)
+//          outIds: cleared and filled with candidate ids
+//
+// int GetCount()
+//      Number of zones inserted since the last Clear().
+//      Params: none
+//---------------------------------------------------------------------------------------------------
+
+class TieredGasZoneIndex
+{
+    static const float DEFAULT_CELL_SIZE = 250.0;
+
+    protected float m_CellSize;
+    protected ref map<int, ref array<int>> m_Cells;
+    protected int m_Count;
+
+    // Per-id stamp used to deduplicate ids that live in several cells during one query.
+    protected ref array<int> m_QueryStamp;
+    protected int m_QueryGen;
+
+    void TieredGasZoneIndex(float cellSize = DEFAULT_CELL_SIZE)
+    {
+        if (cellSize <= 0) cellSize = DEFAULT_CELL_SIZE;
+        m_CellSize = cellSize;
+        m_Cells = new map<int, ref array<int>>;
+        m_QueryStamp = new array<int>;
+        m_QueryGen = 0;
+        m_Count = 0;
+    }
+
+    void Clear()
+    {
+        m_Cells.Clear();
+        m_QueryStamp.Clear();
+        m_QueryGen = 0;
+        m_Count = 0;
+    }
+
+    int GetCount() { return m_Count; }
+    float GetCellSize() { return m_CellSize; }
+
+    protected int CellCoord(float v)
+    {
+        return Math.Floor(v / m_CellSize);
+    }
+
+    protected static int CellKey(int cx, int cz)
+    {
+        return ((cx & 0xFFFF) << 16) | (cz & 0xFFFF);
+    }
+
+    void Insert(int id, vector center, float radius)
+    {
+        if (id < 0) return;
+        if (radius < 0) radius = 0;
+
+        int x0 = CellCoord(center[0] - radius);
+        int x1 = CellCoord(center[0] + radius);
+        int z0 = CellCoord(center[2] - radius);
+        int z1 = CellCoord(center[2] + radius);
+
+        for (int cx = x0; cx <= x1; cx++)
+        {
+            for (int cz = z0; cz <= z1; cz++)
+            {
+                int key = CellKey(cx, cz);
+                array<int> cell = m_Cells.Get(key);
+                if (!cell)
+                {
+                    cell = new array<int>;
+                    m_Cells.Set(key, cell);
+                }
+                cell.Insert(id);
+            }
+        }
+
+        while (m_QueryStamp.Count() <= id)
+            m_QueryStamp.Insert(0);
+
+        m_Count++;
+    }
+
+    void Query(vector pos, float pad, notnull array<int> outIds)
+    {
+        outIds.Clear();
+        if (m_Count == 0) return;
+        if (pad < 0) pad = 0;
+
+        int x0 = CellCoord(pos[0] - pad);
+        int x1 = CellCoord(pos[0] + pad);
+        int z0 = CellCoord(pos[2] - pad);
+        int z1 = CellCoord(pos[2] + pad);
+
+        bool single = (x0 == x1 && z0 == z1);
+        if (!single) m_QueryGen++;
+
+        for (int cx = x0; cx <= x1; cx++)
+        {
+            for (int cz = z0; cz <= z1; cz++)
+            {
+                array<int> cell = m_Cells.Get(CellKey(cx, cz));
+                if (!cell) continue;
+
+                if (single)
+                {
+                    outIds.Copy(cell);
+                    return;
+                }
+
+                foreach (int id : cell)
+                {
+                    if (m_QueryStamp[id] == m_QueryGen) continue;
+                    m_QueryStamp[id] = m_QueryGen;
+                    outIds.Insert(id);
+                }
+            }
+        }
+    }
+};
@@ -0,0 +1,121 @@
+//---------------------------------------------------------------------------------------------------
+// scripts/4_World/07_TieredGasRuntimeZone.c
+//
+// File summary: Compiled, query-ready form of a GasZoneConfig. GasZoneConfig stays the on-disk / sync
+//               representation; hot paths (containment, nearest-zone lookups) only read this record.
+//
+// TieredGasRuntimeZone
+//
+// TieredGasRuntimeZone Compile(GasZoneConfig cfg)
+//      Builds a runtime record from a config (parses the position string once).
+//      Params:
+//          cfg: zone config
+//
+// bool Contains(vector pos)
+//      Exact containment test: horizontal radius + vertical band above the zone ground.
+//      Params:
+//          pos: world position
+//
+// void SetCenter(vector newCenter)
+//      Moves the zone (dynamic zones) and re-resolves the cached ground height.
+//      Params:
+//          newCenter: new zone center
+//
+// void ResolveGround()
+//      Samples terrain height at the center once and caches the vertical bounds.
+//      Params: none
+//
+// float GetBaseY()
+//      World Y of the zone floor (cached terrain height at center minus bottomOffset).
+//      Params: none
+//---------------------------------------------------------------------------------------------------
+
+class TieredGasRuntimeZone
+{
+    string uuid;
+    string name;
+    string colorId;
+
+    vector center;
+    float radius;
+    float radiusSq;
+
+    float height;
+    float bottomOffset;
+    float verticalMargin;
+    float maxRise;
+
+    float groundY;
+    float baseY;
+    float topY;
+
+    int tier;
+    int gasType;
+    int density;
+    bool maskRequired;
+    bool isDynamic;
+
+    static TieredGasRuntimeZone Compile(GasZoneConfig cfg)
+    {
+        if (!cfg) return null;
+
+        TieredGasRuntimeZone rz = new TieredGasRuntimeZone();
+        rz.uuid = cfg.uuid;
+        rz.name = cfg.name;
+        rz.colorId = cfg.colorId;
+
+        rz.center = TieredGasZoneSpawner.ParsePositionString(cfg.position);
+        rz.radius = cfg.radius;
+        rz.radiusSq = cfg.radius * cfg.radius;
+
+        rz.height = cfg.height;
+        rz.bottomOffset = cfg.bottomOffset;
+        rz.verticalMargin = cfg.verticalMargin;
+        rz.maxRise = cfg.height + cfg.verticalMargin;
+
+        rz.tier = cfg.tier;
+        rz.gasType = cfg.gasType;
+        rz.density = TieredGasTypes.DensityStringToEnum(cfg.density);
+        rz.maskRequired = cfg.maskRequired;
+        rz.isDynamic = cfg.isDynamic;
+
+        rz.ResolveGround();
+        return rz;
+    }
+
+    void SetCenter(vector newCenter)
+    {
+        if (newCenter[0] == center[0] && newCenter[2] == center[2])
+        {
+            center = newCenter;
+            return;
+        }
+
+        center = newCenter;
+        ResolveGround();
+    }
+
+    void ResolveGround()
+    {
+        groundY = GetGame().SurfaceY(center[0], center[2]);
+        baseY = groundY - bottomOffset;
+        topY = baseY + maxRise;
+    }
+
+    float GetBaseY()
+    {
+        return baseY;
+    }
+
+    bool Contains(vector pos)
+    {
+        float dx = pos[0] - center[0];
+        float dz = pos[2] - center[2];
+        if ((dx * dx) + (dz * dz) > radiusSq) return false;
+
+        if (pos[1] < baseY) return false;
+        if (pos[1] > topY) return false;
+
+        return true;
+    }
+};
@@ -0,0 +1,309 @@
+//---------------------------------------------------------------------------------------------------
+// scripts/4_World/08_TieredGasOccupancy.c
+//
+// File summary: Server-side registry of which players are inside which zone (by zone UUID). Updated from
+//               each player's containment test, which is the only place containment is discovered:
+//               - the registry resolves each occupant's strongest zone (m_TG_ZoneBest*), which the gas
+//                 state sync reads;
+//               - damage is dispatched from here, iterating only zones that have occupants, so zones
+//                 nobody is in cost nothing in the damage path;
+//               - enter/exit events are available for effects that need them.
+//
+// TieredGasOccupancy
+//
+// ScriptInvoker GetOnEnter()
+//      Invoked as (PlayerBase player, string zoneUUID) when a player enters a zone.
+//      Params: none
+//
+// ScriptInvoker GetOnExit()
+//      Invoked as (PlayerBase player, string zoneUUID) when a player leaves a zone (also on death,
+//      disconnect and zone removal).
+//      Params: none
+//
+// bool UpdatePlayer(PlayerBase player, array<TieredGasRuntimeZone> inside)
+//      Replaces the player's zone set (fires exits then enters) and resolves the strongest containing
+//      zone into the player's m_TG_ZoneBest* state. Returns true if the set changed.
+//      Params:
+//          player: player to update
+//          inside: every zone that currently contains the player
+//
+// void QueueDamage(PlayerBase player, float seconds)
+//      Accumulates gas exposure time from the player's scheduler tick; applied by DispatchDamage.
+//      Params:
+//          player: occupant that ticked
+//          seconds: exact seconds since the player's previous gas tick
+//
+// void DispatchDamage()
+//      Walks the occupied zones and applies queued exposure to each occupant once, from the zone that
+//      is its strongest (ApplyTieredGasDamage). Called after the scheduler's per-frame drain.
+//      Params: none
+//
+// void RemovePlayer(PlayerBase player)
+//      Removes the player from every zone (fires exits).
+//      Params:
+//          player: player to drop
+//
+// void PruneZones()
+//      Drops zones that no longer exist in s_RuntimeZones (fires exits for their occupants and clears
+//      their gas state until the next containment test).
+//      Params: none
+//
+// int GetOccupantCount(string uuid)
+//      Number of players currently inside a zone.
+//      Params:
+//          uuid: zone ID
+//
+// array<PlayerBase> GetOccupants(string uuid)
+//      Players currently inside a zone (null if none). Do not modify.
+//      Params:
+//          uuid: zone ID
+//
+// void Cleanup()
+//      Drops the registry (mission finish).
+//      Params: none
+//---------------------------------------------------------------------------------------------------
+
+class TieredGasPendingDamage
+{
+    PlayerBase player;
+    float seconds;
+    int tier;
+    int gasType;
+    bool maskRequired;
+};
+
+class TieredGasOccupancy
+{
+    static ref map<string, ref array<PlayerBase>> s_Occupants;
+
+    static ref ScriptInvoker s_OnEnter;
+    static ref ScriptInvoker s_OnExit;
+
+    // Set when an occupant queued exposure since the last dispatch.
+    static bool s_DamagePending;
+
+    static ScriptInvoker GetOnEnter()
+    {
+        if (!s_OnEnter) s_OnEnter = new ScriptInvoker();
+        return s_OnEnter;
+    }
+
+    static ScriptInvoker GetOnExit()
+    {
+        if (!s_OnExit) s_OnExit = new ScriptInvoker();
+        return s_OnExit;
+    }
+
+    static bool UpdatePlayer(PlayerBase player, notnull array<TieredGasRuntimeZone> inside)
+    {
+        if (!player) return false;
+        if (!s_Occupants) s_Occupants = new map<string, ref array<PlayerBase>>;
+        if (!player.m_TG_OccupiedZones) player.m_TG_OccupiedZones = new array<string>;
+
+        ResolveState(player, inside);
+
+        array<string> current = player.m_TG_OccupiedZones;
+        bool changed = false;
+
+        for (int i = current.Count() - 1; i >= 0; i--)
+        {
+            string oldUUID = current[i];
+            if (ContainsZone(inside, oldUUID)) continue;
+
+            current.Remove(i);
+            RemoveOccupant(oldUUID, player);
+            changed = true;
+        }
+
+        foreach (TieredGasRuntimeZone rz : inside)
+        {
+            string newUUID = rz.uuid;
+            if (current.Find(newUUID) >= 0) continue;
+
+            current.Insert(newUUID);
+
+            array<PlayerBase> occupants = s_Occupants.Get(newUUID);
+            if (!occupants)
+            {
+                occupants = new array<PlayerBase>;
+                s_Occupants.Set(newUUID, occupants);
+            }
+            occupants.Insert(player);
+
+            if (s_OnEnter) s_OnEnter.Invoke(player, newUUID);
+            changed = true;
+        }
+
+        return changed;
+    }
+
+    static void QueueDamage(PlayerBase player, float seconds)
+    {
+        if (!player || seconds <= 0) return;
+
+        player.m_TG_PendingGasSeconds += seconds;
+        s_DamagePending = true;
+    }
+
+    static void DispatchDamage()
+    {
+        if (!s_DamagePending || !s_Occupants) return;
+        s_DamagePending = false;
+
+        array<ref TieredGasPendingDamage> jobs = new array<ref TieredGasPendingDamage>;
+
+        foreach (string uuid, array<PlayerBase> occupants : s_Occupants)
+        {
+            if (!occupants) continue;
+
+            foreach (PlayerBase p : occupants)
+            {
+                // Overlapping zones: only the occupant's strongest zone applies its exposure.
+                if (!p || p.m_TG_PendingGasSeconds <= 0 || p.m_TG_ZoneBestUUID != uuid) continue;
+
+                TieredGasPendingDamage job = new TieredGasPendingDamage();
+                job.player = p;
+                job.seconds = p.m_TG_PendingGasSeconds;
+                job.tier = p.m_TG_ZoneBestTier;
+                job.gasType = p.m_TG_ZoneBestType;
+                if (job.gasType < 0) job.gasType = 0;
+                job.maskRequired = p.m_TG_ZoneBestMask;
+                jobs.Insert(job);
+
+                p.m_TG_PendingGasSeconds = 0;
+            }
+        }
+
+        // Applied after the walk: lethal damage runs EEKilled -> RemovePlayer, which edits s_Occupants.
+        foreach (TieredGasPendingDamage d : jobs)
+        {
+            ApplyTieredGasDamage(d.player, d.seconds, d.tier, d.gasType, d.maskRequired);
+        }
+    }
+
+    static void RemovePlayer(PlayerBase player)
+    {
+        if (!player) return;
+
+        ClearState(player);
+        if (!player.m_TG_OccupiedZones) return;
+
+        array<string> current = player.m_TG_OccupiedZones;
+        for (int i = current.Count() - 1; i >= 0; i--)
+        {
+            string uuid = current[i];
+            current.Remove(i);
+            RemoveOccupant(uuid, player);
+        }
+    }
+
+    static void PruneZones()
+    {
+        if (!s_Occupants || s_Occupants.Count() == 0) return;
+
+        map<string, bool> alive = new map<string, bool>;
+        array<ref TieredGasRuntimeZone> zones = TieredGasZoneSpawner.s_RuntimeZones;
+        if (zones)
+        {
+            foreach (TieredGasRuntimeZone rz : zones)
+            {
+                if (rz) alive.Set(rz.uuid, true);
+            }
+        }
+
+        array<string> gone = new array<string>;
+        foreach (string uuid, array<PlayerBase> occ : s_Occupants)
+        {
+            if (!alive.Contains(uuid)) gone.Insert(uuid);
+        }
+
+        foreach (string goneUUID : gone)
+        {
+            array<PlayerBase> occupants = s_Occupants.Get(goneUUID);
+            s_Occupants.Remove(goneUUID);
+            if (!occupants) continue;
+
+            foreach (PlayerBase p : occupants)
+            {
+                if (!p) continue;
+                if (p.m_TG_OccupiedZones)
+                {
+                    int idx = p.m_TG_OccupiedZones.Find(goneUUID);
+                    if (idx >= 0) p.m_TG_OccupiedZones.Remove(idx);
+                }
+                if (p.m_TG_ZoneBestUUID == goneUUID) ClearState(p);
+                if (s_OnExit) s_OnExit.Invoke(p, goneUUID);
+            }
+        }
+    }
+
+    static int GetOccupantCount(string uuid)
+    {
+        if (!s_Occupants) return 0;
+        array<PlayerBase> occupants = s_Occupants.Get(uuid);
+        if (!occupants) return 0;
+        return occupants.Count();
+    }
+
+    static array<PlayerBase> GetOccupants(string uuid)
+    {
+        if (!s_Occupants) return null;
+        return s_Occupants.Get(uuid);
+    }
+
+    static void Cleanup()
+    {
+        s_Occupants = null;
+        s_OnEnter = null;
+        s_OnExit = null;
+        s_DamagePending = false;
+    }
+
+    protected static void ResolveState(PlayerBase player, array<TieredGasRuntimeZone> inside)
+    {
+        ClearState(player);
+
+        foreach (TieredGasRuntimeZone rz : inside)
+        {
+            if (rz.tier <= player.m_TG_ZoneBestTier) continue;
+
+            player.m_TG_ZoneBestUUID = rz.uuid;
+            player.m_TG_ZoneBestTier = rz.tier;
+            player.m_TG_ZoneBestType = rz.gasType;
+            player.m_TG_ZoneBestMask = rz.maskRequired;
+        }
+    }
+
+    protected static void ClearState(PlayerBase player)
+    {
+        player.m_TG_ZoneBestUUID = "";
+        player.m_TG_ZoneBestTier = 0;
+        player.m_TG_ZoneBestType = -1;
+        player.m_TG_ZoneBestMask = false;
+    }
+
+    protected static bool ContainsZone(array<TieredGasRuntimeZone> zones, string uuid)
+    {
+        foreach (TieredGasRuntimeZone rz : zones)
+        {
+            if (rz.uuid == uuid) return true;
+        }
+        return false;
+    }
+
+    protected static void RemoveOccupant(string uuid, PlayerBase player)
+    {
+        if (s_Occupants)
+        {
+            array<PlayerBase> occupants = s_Occupants.Get(uuid);
+            if (occupants)
+            {
+                int idx = occupants.Find(player);
+                if (idx >= 0) occupants.Remove(idx);
+                if (occupants.Count() == 0) s_Occupants.Remove(uuid);
+            }
+        }
+
+        if (s_OnExit) s_OnExit.Invoke(player, uuid);
+    }
+};
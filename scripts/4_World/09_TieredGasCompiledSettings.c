@@ -0,0 +1,143 @@
+//---------------------------------------------------------------------------------------------------
+// scripts/4_World/09_TieredGasCompiledSettings.c
+//
+// File summary: Immutable, int-indexed snapshot of GasSettings.json built at the end of TieredGasJSON.Load.
+//               One TieredGasCompiledTier per (gasType, tier) with multipliers, chances and effect gates
+//               already resolved, so the damage / FX paths never touch the string-keyed settings maps.
+//               A reload builds a new snapshot and swaps the reference; callers hold the one they fetched.
+//
+// TieredGasCompiledSettings
+//
+// TieredGasCompiledSettings Compile()
+//      Builds a snapshot from the currently loaded TieredGasJSON statics.
+//      Params: none
+//
+// TieredGasCompiledTier Get(int gasType, int tier)
+//      Returns the entry for a gas type + tier (null only if the gas type is not configured). Tiers above
+//      the highest configured one share a trailing entry compiled without tier data (default
+//      multipliers), as the uncompiled lookups did.
+//      Params:
+//          gasType: TieredGasType value
+//          tier: gas tier
+//
+// TieredGasCompiledTier
+//
+// bool Allows(int effectBit)
+//      Tests a TIEREDGAS_FX_* bit (rule enabled for this tier and, for cough/blur, enabled on the gas type).
+//      Params:
+//          effectBit: TIEREDGAS_FX_* constant
+//---------------------------------------------------------------------------------------------------
+
+const int TIEREDGAS_FX_COUGH           = 1;
+const int TIEREDGAS_FX_BLUR            = 2;
+const int TIEREDGAS_FX_NERVE_PERMANENT = 4;
+const int TIEREDGAS_FX_BIO_INFECTION   = 8;
+const int TIEREDGAS_FX_TOXIC_WOUND     = 16;
+
+class TieredGasCompiledTier
+{
+    float healthDamage;
+    float bloodDamage;
+    float shockDamage;
+
+    float damageMultiplier = 1.0;
+    float filterDrain = 1.0;     // gas type drain * tier filterMultiplier
+
+    float toxicBleedChance;
+    float bioInfectionChance;
+
+    float gasBlur;
+
+    int effects;
+
+    bool Allows(int effectBit)
+    {
+        return (effects & effectBit) != 0;
+    }
+};
+
+class TieredGasCompiledSettings
+{
+    static const int GAS_TYPE_COUNT = 3;
+    static const int MAX_TIER = 4;
+
+    protected ref array<ref TieredGasCompiledTier> m_Entries;
+
+    // Entries per gas type: tiers 0..max(MAX_TIER, highest configured tier), plus the trailing default entry.
+    protected int m_TierCount;
+
+    float toxicBleedChanceCap;
+    float bioInfectionChanceCap;
+
+    static TieredGasCompiledSettings Compile()
+    {
+        TieredGasCompiledSettings cs = new TieredGasCompiledSettings();
+        cs.m_Entries = new array<ref TieredGasCompiledTier>;
+
+        cs.toxicBleedChanceCap   = TieredGasJSON.GetToxicBleedChanceCap();
+        cs.bioInfectionChanceCap = TieredGasJSON.GetBioInfectionChanceCap();
+
+        int maxTier = MAX_TIER;
+        if (TieredGasJSON.s_Tiers)
+        {
+            foreach (int configured, GasTierData td : TieredGasJSON.s_Tiers)
+            {
+                if (configured > maxTier) maxTier = configured;
+            }
+        }
+        cs.m_TierCount = maxTier + 2;
+
+        for (int gasType = 0; gasType < GAS_TYPE_COUNT; gasType++)
+        {
+            GasTypeData data;
+            if (TieredGasJSON.s_GasTypes)
+                data = TieredGasJSON.s_GasTypes.Get(TieredGasTypes.GasTypeToString(gasType));
+
+            for (int tier = 0; tier < cs.m_TierCount; tier++)
+            {
+                if (!data)
+                {
+                    cs.m_Entries.Insert(null);
+                    continue;
+                }
+
+                TieredGasCompiledTier e = new TieredGasCompiledTier();
+                e.healthDamage = data.healthDamage;
+                e.bloodDamage  = data.bloodDamage;
+                e.shockDamage  = data.shockDamage;
+                e.filterDrain  = data.filterDrain;
+
+                GasTierData tierData;
+                if (TieredGasJSON.s_Tiers)
+                    tierData = TieredGasJSON.s_Tiers.Get(tier);
+                if (tierData)
+                {
+                    e.damageMultiplier = tierData.damageMultiplier;
+                    e.filterDrain *= tierData.filterMultiplier;
+                }
+
+                e.toxicBleedChance   = TieredGasJSON.GetToxicBleedChanceForTier(tier);
+                e.bioInfectionChance = TieredGasJSON.GetBioInfectionChanceForTier(tier);
+                e.gasBlur            = TieredGasJSON.GetGasBlurForTier(tier);
+
+                if (data.cough && TieredGasJSON.AllowsTierEffect("COUGH", tier)) e.effects |= TIEREDGAS_FX_COUGH;
+                if (data.blur  && TieredGasJSON.AllowsTierEffect("BLUR", tier))  e.effects |= TIEREDGAS_FX_BLUR;
+                if (TieredGasJSON.AllowsPermanentEffect("NERVE_PERMANENT", tier)) e.effects |= TIEREDGAS_FX_NERVE_PERMANENT;
+                if (TieredGasJSON.AllowsPermanentEffect("BIO_INFECTION", tier))   e.effects |= TIEREDGAS_FX_BIO_INFECTION;
+                if (TieredGasJSON.AllowsPermanentEffect("TOXIC_WOUND", tier))     e.effects |= TIEREDGAS_FX_TOXIC_WOUND;
+
+                cs.m_Entries.Insert(e);
+            }
+        }
+
+        return cs;
+    }
+
+    TieredGasCompiledTier Get(int gasType, int tier)
+    {
+        if (gasType < 0 || gasType >= GAS_TYPE_COUNT) return null;
+        if (tier < 0) tier = 0;
+        if (tier >= m_TierCount) tier = m_TierCount - 1;
+        return m_Entries[(gasType * m_TierCount) + tier];
+    }
+};
@@ -0,0 +1,364 @@
+//---------------------------------------------------------------------------------------------------
+// scripts/4_World/10_TieredGasZoneSyncCodec.c
+//
+// File summary: Compact binary zone sync (RPC_TIERED_GAS_ZONES_SYNC_BIN). Zone records are packed into
+//               chunks of up to RECORDS_PER_CHUNK; each chunk carries its own string table (UUIDs, names,
+//               custom colors) so chunks decode independently and in any order.
+//
+//               Chunk layout (all ints / floats are fixed width):
+//                   int   FORMAT_VERSION
+//                   int   payload version (server zone set version)
+//                   int   content hash of the whole zone set
+//                   int   chunk index, int chunk count
+//                   int   string count, string x count
+//                   int   record count, then per record:
+//                         int uuid string idx, int name string idx
+//                         int packed: tier(0-2) gasType(3-4) density(5-6) mask(7) dynamic(8) cycle(9)
+//                                     color code(10-17, 0xFF = custom)
+//                         int custom color string idx (-1 if built-in)
+//                         float x, y, z, radius, height, bottomOffset, verticalMargin, cycleSeconds
+//
+// TieredGasZoneSyncChunk
+//
+// void Write(ParamsWriteContext ctx, int payloadVersion, int hash, int chunkCount)
+//      Writes this prepared chunk.
+//      Params:
+//          ctx: RPC writer
+//          payloadVersion: zone set version the chunk belongs to
+//          hash: content hash of the whole zone set
+//          chunkCount: total chunks in this payload
+//
+// int EstimateBytes()
+//      Approximate serialized size (used for the per-frame send budget).
+//      Params: none
+//
+// TieredGasZoneSyncCodec
+//
+// void BuildChunks(array<ref GasZoneConfig> zones, array<ref TieredGasZoneSyncChunk> outChunks)
+//      Packs a zone list into prepared chunks (done once per zone set change on the server).
+//      Params:
+//          zones: zone configs
+//          outChunks: cleared and filled
+//
+// bool ReadChunk(ParamsReadContext ctx, out int payloadVersion, out int hash, out int chunkIndex, out int chunkCount, array<ref GasZoneConfig> outZones)
+//      Decodes one chunk, appending its records to outZones.
+//      Params:
+//          ctx: RPC reader
+//          payloadVersion / hash / chunkIndex / chunkCount: header values (out)
+//          outZones: decoded configs are appended here
+//
+// int HashZone(GasZoneConfig cfg)
+//      Content hash of one zone record (every synced field).
+//      Params:
+//          cfg: zone config
+//
+// int HashZones(array<ref GasZoneConfig> zones)
+//      Order-dependent hash of a whole zone list.
+//      Params:
+//          zones: zone configs
+//
+// TieredGasZoneChange
+//      One change-log entry: UUIDs added/modified and removed by the zone set change that produced
+//      `version`.
+//
+// TieredGasZoneDelta
+//
+// void Write(ParamsWriteContext ctx)
+//      Writes a delta (RPC_TIERED_GAS_ZONES_DELTA): format, from/to version, hash, removed UUIDs, then the
+//      upserted records as a single chunk in the layout above.
+//      Params:
+//          ctx: RPC writer
+//
+// bool Read(ParamsReadContext ctx, out int fromV, out int toV, out int h, array<string> outRemovals, array<ref GasZoneConfig> outUpserts)
+//      Decodes a delta.
+//      Params:
+//          ctx: RPC reader
+//          fromV / toV / h: version range and new content hash (out)
+//          outRemovals: removed UUIDs
+//          outUpserts: added / modified zones
+//---------------------------------------------------------------------------------------------------
+
+class TieredGasZoneSyncChunk
+{
+    int chunkIndex;
+    ref array<string> strings = new array<string>;
+    ref array<int> ints = new array<int>;       // 4 per record
+    ref array<float> floats = new array<float>; // 8 per record
+
+    int GetRecordCount()
+    {
+        return ints.Count() / TieredGasZoneSyncCodec.INTS_PER_RECORD;
+    }
+
+    int AddString(string s, map<string, int> lookup)
+    {
+        int idx;
+        if (lookup.Find(s, idx)) return idx;
+
+        idx = strings.Count();
+        strings.Insert(s);
+        lookup.Set(s, idx);
+        return idx;
+    }
+
+    int EstimateBytes()
+    {
+        int bytes = 4 * (7 + ints.Count() + floats.Count());
+        foreach (string s : strings)
+            bytes += 4 + s.Length();
+        return bytes;
+    }
+
+    void Write(ParamsWriteContext ctx, int payloadVersion, int hash, int chunkCount)
+    {
+        int format = TieredGasZoneSyncCodec.FORMAT_VERSION;
+        ctx.Write(format);
+        ctx.Write(payloadVersion);
+        ctx.Write(hash);
+        ctx.Write(chunkIndex);
+        ctx.Write(chunkCount);
+
+        int sc = strings.Count();
+        ctx.Write(sc);
+        for (int s = 0; s < sc; s++)
+            ctx.Write(strings[s]);
+
+        int rc = GetRecordCount();
+        ctx.Write(rc);
+
+        for (int r = 0; r < rc; r++)
+        {
+            int ii = r * TieredGasZoneSyncCodec.INTS_PER_RECORD;
+            for (int a = 0; a < TieredGasZoneSyncCodec.INTS_PER_RECORD; a++)
+                ctx.Write(ints[ii + a]);
+
+            int fi = r * TieredGasZoneSyncCodec.FLOATS_PER_RECORD;
+            for (int b = 0; b < TieredGasZoneSyncCodec.FLOATS_PER_RECORD; b++)
+                ctx.Write(floats[fi + b]);
+        }
+    }
+};
+
+class TieredGasZoneSyncCodec
+{
+    static const int FORMAT_VERSION = 1;
+    static const int RECORDS_PER_CHUNK = 64;
+    static const int INTS_PER_RECORD = 4;
+    static const int FLOATS_PER_RECORD = 8;
+    static const int COLOR_CUSTOM = 0xFF;
+
+    static void BuildChunks(array<ref GasZoneConfig> zones, notnull array<ref TieredGasZoneSyncChunk> outChunks)
+    {
+        outChunks.Clear();
+
+        TieredGasZoneSyncChunk chunk;
+        map<string, int> lookup;
+
+        int zoneCount = 0;
+        if (zones) zoneCount = zones.Count();
+
+        for (int zi = 0; zi < zoneCount; zi++)
+        {
+            GasZoneConfig cfg = zones[zi];
+            if (!cfg) continue;
+
+            if (!chunk || chunk.GetRecordCount() >= RECORDS_PER_CHUNK)
+            {
+                chunk = new TieredGasZoneSyncChunk();
+                chunk.chunkIndex = outChunks.Count();
+                outChunks.Insert(chunk);
+                lookup = new map<string, int>;
+            }
+
+            int colorCode = TieredGasTypes.ColorStringToCode(cfg.colorId);
+            int colorStr = -1;
+            if (colorCode < 0)
+            {
+                colorCode = COLOR_CUSTOM;
+                colorStr = chunk.AddString(cfg.colorId, lookup);
+            }
+
+            int packed = (cfg.tier & 0x7);
+            packed |= (cfg.gasType & 0x3) << 3;
+            packed |= (TieredGasTypes.DensityStringToEnum(cfg.density) & 0x3) << 5;
+            if (cfg.maskRequired) packed |= 1 << 7;
+            if (cfg.isDynamic)    packed |= 1 << 8;
+            if (cfg.cycle)        packed |= 1 << 9;
+            packed |= (colorCode & 0xFF) << 10;
+
+            chunk.ints.Insert(chunk.AddString(cfg.uuid, lookup));
+            chunk.ints.Insert(chunk.AddString(cfg.name, lookup));
+            chunk.ints.Insert(packed);
+            chunk.ints.Insert(colorStr);
+
+            vector pos = TieredGasZoneSpawner.ParsePositionString(cfg.position);
+            chunk.floats.Insert(pos[0]);
+            chunk.floats.Insert(pos[1]);
+            chunk.floats.Insert(pos[2]);
+            chunk.floats.Insert(cfg.radius);
+            chunk.floats.Insert(cfg.height);
+            chunk.floats.Insert(cfg.bottomOffset);
+            chunk.floats.Insert(cfg.verticalMargin);
+            chunk.floats.Insert(cfg.cycleSeconds);
+        }
+
+        // An empty zone set still needs one (empty) chunk so clients clear their zones.
+        if (outChunks.Count() == 0)
+            outChunks.Insert(new TieredGasZoneSyncChunk());
+    }
+
+    static bool ReadChunk(ParamsReadContext ctx, out int payloadVersion, out int hash, out int chunkIndex, out int chunkCount, notnull array<ref GasZoneConfig> outZones)
+    {
+        int format;
+        if (!ctx.Read(format)) return false;
+        if (format != FORMAT_VERSION) return false;
+
+        if (!ctx.Read(payloadVersion)) return false;
+        if (!ctx.Read(hash)) return false;
+        if (!ctx.Read(chunkIndex)) return false;
+        if (!ctx.Read(chunkCount)) return false;
+
+        int sc;
+        if (!ctx.Read(sc) || sc < 0) return false;
+
+        array<string> strings = new array<string>;
+        for (int s = 0; s < sc; s++)
+        {
+            string str;
+            if (!ctx.Read(str)) return false;
+            strings.Insert(str);
+        }
+
+        int rc;
+        if (!ctx.Read(rc) || rc < 0) return false;
+
+        for (int r = 0; r < rc; r++)
+        {
+            int uuidIdx, nameIdx, packed, colorStr;
+            if (!ctx.Read(uuidIdx) || !ctx.Read(nameIdx) || !ctx.Read(packed) || !ctx.Read(colorStr)) return false;
+
+            float x, y, z, radius, height, bottomOffset, verticalMargin, cycleSeconds;
+            if (!ctx.Read(x) || !ctx.Read(y) || !ctx.Read(z)) return false;
+            if (!ctx.Read(radius) || !ctx.Read(height) || !ctx.Read(bottomOffset)) return false;
+            if (!ctx.Read(verticalMargin) || !ctx.Read(cycleSeconds)) return false;
+
+            if (uuidIdx < 0 || uuidIdx >= sc || nameIdx < 0 || nameIdx >= sc) return false;
+
+            GasZoneConfig cfg = new GasZoneConfig();
+            cfg.uuid = strings[uuidIdx];
+            cfg.name = strings[nameIdx];
+
+            cfg.tier         = packed & 0x7;
+            cfg.gasType      = (packed >> 3) & 0x3;
+            cfg.density      = TieredGasTypes.DensityEnumToString((packed >> 5) & 0x3);
+            cfg.maskRequired = ((packed >> 7) & 1) != 0;
+            cfg.isDynamic    = ((packed >> 8) & 1) != 0;
+            cfg.cycle        = ((packed >> 9) & 1) != 0;
+
+            int colorCode = (packed >> 10) & 0xFF;
+            if (colorCode == COLOR_CUSTOM && colorStr >= 0 && colorStr < sc)
+                cfg.colorId = strings[colorStr];
+            else
+                cfg.colorId = TieredGasTypes.ColorCodeToString(colorCode);
+
+            cfg.position = x.ToString() + " " + y.ToString() + " " + z.ToString();
+            cfg.radius = radius;
+            cfg.height = height;
+            cfg.bottomOffset = bottomOffset;
+            cfg.verticalMargin = verticalMargin;
+            cfg.cycleSeconds = cycleSeconds;
+
+            outZones.Insert(cfg);
+        }
+
+        return true;
+    }
+
+    static int HashZone(GasZoneConfig cfg)
+    {
+        if (!cfg) return 0;
+
+        string s = cfg.uuid + "|" + cfg.name + "|" + cfg.colorId + "|" + cfg.density + "|" + cfg.position;
+        s = s + "|" + cfg.radius.ToString() + "|" + cfg.tier.ToString() + "|" + cfg.gasType.ToString();
+        s = s + "|" + cfg.maskRequired.ToString() + "|" + cfg.height.ToString() + "|" + cfg.bottomOffset.ToString();
+        s = s + "|" + cfg.verticalMargin.ToString() + "|" + cfg.isDynamic.ToString() + "|" + cfg.cycle.ToString() + "|" + cfg.cycleSeconds.ToString();
+        return s.Hash();
+    }
+
+    static int HashZones(array<ref GasZoneConfig> zones)
+    {
+        int h = 17;
+        if (!zones) return h;
+
+        foreach (GasZoneConfig cfg : zones)
+        {
+            if (!cfg) continue;
+            h = (h * 31) + HashZone(cfg);
+        }
+        return h;
+    }
+};
+
+class TieredGasZoneChange
+{
+    int version;
+    ref array<string> upserts = new array<string>;
+    ref array<string> removals = new array<string>;
+
+    void TieredGasZoneChange(int v)
+    {
+        version = v;
+    }
+};
+
+class TieredGasZoneDelta
+{
+    int fromVersion;
+    int toVersion;
+    int hash;
+    ref array<string> removals = new array<string>;
+    ref TieredGasZoneSyncChunk upserts;
+
+    int EstimateBytes()
+    {
+        int bytes = 4 * 5 + upserts.EstimateBytes();
+        foreach (string uuid : removals)
+            bytes += 4 + uuid.Length();
+        return bytes;
+    }
+
+    void Write(ParamsWriteContext ctx)
+    {
+        int format = TieredGasZoneSyncCodec.FORMAT_VERSION;
+        ctx.Write(format);
+        ctx.Write(fromVersion);
+        ctx.Write(toVersion);
+        ctx.Write(hash);
+
+        int rc = removals.Count();
+        ctx.Write(rc);
+        for (int i = 0; i < rc; i++)
+            ctx.Write(removals[i]);
+
+        upserts.Write(ctx, toVersion, hash, 1);
+    }
+
+    static bool Read(ParamsReadContext ctx, out int fromV, out int toV, out int h, notnull array<string> outRemovals, notnull array<ref GasZoneConfig> outUpserts)
+    {
+        int format;
+        if (!ctx.Read(format) || format != TieredGasZoneSyncCodec.FORMAT_VERSION) return false;
+        if (!ctx.Read(fromV) || !ctx.Read(toV) || !ctx.Read(h)) return false;
+
+        int rc;
+        if (!ctx.Read(rc) || rc < 0) return false;
+        for (int i = 0; i < rc; i++)
+        {
+            string uuid;
+            if (!ctx.Read(uuid)) return false;
+            outRemovals.Insert(uuid);
+        }
+
+        int pv, ph, ci, cc;
+        return TieredGasZoneSyncCodec.ReadChunk(ctx, pv, ph, ci, cc, outUpserts);
+    }
+};
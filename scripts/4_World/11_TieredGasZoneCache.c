@@ -0,0 +1,129 @@
+//---------------------------------------------------------------------------------------------------
+// scripts/4_World/11_TieredGasZoneCache.c
+//
+// File summary: Client-side persistent copy of the last zone set received from a server, stored under
+//               $profile:TieredGas/ZoneCache/<host>_<port>.json together with the server's content hash.
+//               The join request carries that hash; when it still matches, the server only answers
+//               RPC_TIERED_GAS_ZONES_UNCHANGED and the client applies the cached set.
+//
+// TieredGasZoneCache
+//
+// bool GetHash(out int hash)
+//      Hash of the cached zone set for the current server (false if there is no cache).
+//      Params:
+//          hash: cached content hash (out)
+//
+// bool Load(int expectedHash, array<ref GasZoneConfig> outZones)
+//      Fills outZones from the cache if its hash matches expectedHash.
+//      Params:
+//          expectedHash: hash the server reported
+//          outZones: cached zones
+//
+// void Save(int hash)
+//      Writes the currently applied client zone set (m_ClientConfigsByUUID) with the server's hash.
+//      Params:
+//          hash: server content hash of that zone set
+//
+// void Cleanup()
+//      Drops the in-memory copy (mission finish / server switch).
+//      Params: none
+//---------------------------------------------------------------------------------------------------
+
+class TieredGasZoneCacheData
+{
+    int hash;
+    ref array<ref GasZoneConfig> zones = new array<ref GasZoneConfig>;
+};
+
+class TieredGasZoneCache
+{
+    protected static ref TieredGasZoneCacheData s_Data;
+    protected static bool s_Loaded;
+
+    static string GetFolder()
+    {
+        return TieredGasJSON.GetConfigFolder() + "/ZoneCache";
+    }
+
+    static string GetPath()
+    {
+        string address;
+        int port;
+        if (!GetGame().GetHostAddress(address, port) || address == "")
+        {
+            address = "local";
+            port = 0;
+        }
+
+        string key = address + "_" + port.ToString();
+        key.Replace(".", "_");
+        key.Replace(":", "_");
+        return GetFolder() + "/" + key + ".json";
+    }
+
+    protected static void EnsureLoaded()
+    {
+        if (s_Loaded) return;
+        s_Loaded = true;
+
+        string path = GetPath();
+        if (!FileExist(path)) return;
+
+        s_Data = new TieredGasZoneCacheData();
+        JsonFileLoader<TieredGasZoneCacheData>.JsonLoadFile(path, s_Data);
+        if (!s_Data.zones) s_Data = null;
+    }
+
+    static bool GetHash(out int hash)
+    {
+        EnsureLoaded();
+        if (!s_Data) return false;
+
+        hash = s_Data.hash;
+        return true;
+    }
+
+    static bool Load(int expectedHash, notnull array<ref GasZoneConfig> outZones)
+    {
+        EnsureLoaded();
+        if (!s_Data || s_Data.hash != expectedHash) return false;
+
+        foreach (GasZoneConfig cfg : s_Data.zones)
+        {
+            if (cfg) outZones.Insert(cfg);
+        }
+        return true;
+    }
+
+    static void Save(int hash)
+    {
+        map<string, ref GasZoneConfig> configs = TieredGasZoneSpawner.m_ClientConfigsByUUID;
+        if (!configs) return;
+
+        TieredGasZoneCacheData data = new TieredGasZoneCacheData();
+        data.hash = hash;
+        foreach (string uuid, GasZoneConfig cfg : configs)
+        {
+            if (cfg) data.zones.Insert(cfg);
+        }
+
+        string folder = TieredGasJSON.GetConfigFolder();
+        if (!FileExist(folder)) { MakeDirectory(folder); }
+        folder = GetFolder();
+        if (!FileExist(folder)) { MakeDirectory(folder); }
+
+        JsonFileLoader<TieredGasZoneCacheData>.JsonSaveFile(GetPath(), data);
+
+        s_Data = data;
+        s_Loaded = true;
+
+        if (TieredGasLog.IsEnabled(TieredGasLogLevel.DEBUG))
+            TieredGasLog.LogDebug("[TieredGas] Zone cache saved (" + data.zones.Count() + " zones, hash=" + hash + ")");
+    }
+
+    static void Cleanup()
+    {
+        s_Data = null;
+        s_Loaded = false;
+    }
+};
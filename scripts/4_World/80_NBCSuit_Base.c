@@ -42,7 +42,7 @@ class NBCSuit_Base : Clothing
     protected int m_ProtectionTier = 0;
     void NBCSuit_Base()
     {
-        Print("[TieredGasMod] NBC Suit Loaded");
+        TieredGasLog.LogTrace("[TieredGasMod] NBC Suit Loaded");
     }
 
     override void OnWasAttached(EntityAI parent, int slot_id)
@@ -60,13 +60,15 @@ class NBCSuit_Base : Clothing
         else if (className.Contains("Tier4")) { m_ProtectionTier = 4; }
         else { m_ProtectionTier = 0; } 
 
-        Print("[NBCSuit] Class: " + className + " | ProtectionTier: " + m_ProtectionTier);
+        if (TieredGasLog.IsEnabled(TieredGasLogLevel.DEBUG))
+            TieredGasLog.LogDebug("[NBCSuit] Class: " + className + " | ProtectionTier: " + m_ProtectionTier);
     }
 
     int GetProtectionTier()
     {
         if (m_ProtectionTier == 0) { InitializeTier(); }
-        Print("[NBCSuit] GetProtectionTier(): " + m_ProtectionTier);
+        if (TieredGasLog.IsEnabled(TieredGasLogLevel.TRACE))
+            TieredGasLog.LogTrace("[NBCSuit] GetProtectionTier(): " + m_ProtectionTier);
         return m_ProtectionTier;
     }
 
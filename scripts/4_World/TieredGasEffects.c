@@ -16,10 +16,12 @@ class TieredGasEffects
 
         if (inGas && tier > 0)
         {
-            GasTypeData d = TieredGasJSON.GetGasType(TieredGasTypes.GasTypeToString(gasType));
-            if (d && d.blur && TieredGasJSON.AllowsTierEffect("BLUR", tier))
+            TieredGasCompiledSettings settings = TieredGasJSON.GetCompiled();
+            TieredGasCompiledTier d;
+            if (settings) d = settings.Get(gasType, tier);
+            if (d && d.Allows(TIEREDGAS_FX_BLUR))
             {
-                blurTarget = TieredGasJSON.GetGasBlurForTier(tier);
+                blurTarget = d.gasBlur;
 
             }
         }
@@ -0,0 +1,42 @@
+//---------------------------------------------------------------------------------------------------
+// scripts/4_World/TieredGasItemBase.c
+//
+// File summary: Item-side hooks that keep the per-player protection snapshot current. Masks, filters and
+//               suits change state on the item (health level, nested attachments), which the player's own
+//               attach/detach events do not see.
+//
+// ItemBase (modded)
+//
+// void EEHealthLevelChanged(int oldLevel, int newLevel, string zone)
+//      Invalidates the carrying player's protection snapshot (e.g. mask becomes ruined).
+//      Params: engine-provided health level context (as named)
+//
+// void EEItemAttached(EntityAI item, string slot_name)
+//      Invalidates the carrying player's protection snapshot (e.g. filter screwed onto a worn mask).
+//      Params: engine-provided attachment context (as named)
+//
+// void EEItemDetached(EntityAI item, string slot_name)
+//      Invalidates the carrying player's protection snapshot (e.g. filter removed from a worn mask).
+//      Params: engine-provided attachment context (as named)
+//---------------------------------------------------------------------------------------------------
+
+modded class ItemBase
+{
+    override void EEHealthLevelChanged(int oldLevel, int newLevel, string zone)
+    {
+        super.EEHealthLevelChanged(oldLevel, newLevel, zone);
+        if (GetGame().IsServer()) { TieredGasProtection.InvalidateOwner(this); }
+    }
+
+    override void EEItemAttached(EntityAI item, string slot_name)
+    {
+        super.EEItemAttached(item, slot_name);
+        if (GetGame().IsServer()) { TieredGasProtection.InvalidateOwner(this); }
+    }
+
+    override void EEItemDetached(EntityAI item, string slot_name)
+    {
+        super.EEItemDetached(item, slot_name);
+        if (GetGame().IsServer()) { TieredGasProtection.InvalidateOwner(this); }
+    }
+};
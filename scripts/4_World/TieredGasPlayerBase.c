@@ -31,6 +31,23 @@
 //      Params:
 //          deltaTime: frame delta time
 //
+// void TG_ServerGasTick(float tickDelta)
+//      Server gas tick invoked by TieredGasServerScheduler (zone evaluation + persistent effects).
+//      Params:
+//          tickDelta: exact seconds since this player's previous gas tick
+//
+// void TG_EvaluateZones(int nowMS)
+//      Full zone query: caches the zones within the move threshold and how far the player can move
+//      before any other zone could contain them, then tests the cached zones.
+//      Params:
+//          nowMS: current game time (ms)
+//
+// void TG_TestCachedZones(vector p)
+//      Exact containment against the cached zones only; publishes the containing zones to
+//      TieredGasOccupancy, which resolves the best tier/type/maskRequired into m_TG_ZoneBest*.
+//      Params:
+//          p: player position
+//
 // void TieredGas_ClearGasState()
 //      Clears gas state when leaving zones / reset.
 //      Params: none
@@ -62,6 +79,33 @@
 //      Server-side reload zones action.
 //      Params: none
 //
+// void TieredGas_BenchmarkZones_Server()
+//      Server-side admin action: times zone containment queries with and without the spatial index
+//      (sampled at every connected player's position) and reports the result to the admin.
+//      Params: none
+//
+// void TG_HandleBinaryZoneSync(ParamsReadContext ctx)
+//      Client: decodes one binary zone sync chunk and applies the zone set once every chunk arrived.
+//      Params:
+//          ctx: RPC payload reader
+//
+// void TG_HandleZoneDelta(ParamsReadContext ctx)
+//      Client: applies a zone delta if it starts at the locally applied version, otherwise asks the
+//      server for a full resync.
+//      Params:
+//          ctx: RPC payload reader
+//
+// void TG_HandleZonesUnchanged(ParamsReadContext ctx)
+//      Client: server confirmed the cached zone set; applies it from the profile cache (or asks for a full
+//      sync if the cache is gone).
+//      Params:
+//          ctx: RPC payload reader
+//
+// void TG_HandleZoneInterest(ParamsReadContext ctx)
+//      Client: applies one interest streaming batch (zones entering / leaving the interest radius).
+//      Params:
+//          ctx: RPC payload reader
+//
 // void SendAdminMessage(PlayerIdentity ident, string msg, bool isError)
 //      Server sends an admin feedback message to a client.
 //      Params:
@@ -92,13 +136,29 @@
 //          version: save version
 //
 // void Init()
-//      Player init hook for TieredGas variables.
+//      Player init hook for TieredGas variables; registers the replicated gas state (m_TG_GasNetState).
 //      Params: none
 //
+// void OnVariablesSynchronized()
+//      Client: decodes m_TG_GasNetState into the HUD / FX state (in gas, tier, type, nerve active).
+//      Params: none
+//
+// int TG_PackGasNetState(bool inGas, int tier, int gasType, bool nerveActive)
+//      Packs the gas state into the replicated int.
+//      Params:
+//          inGas: inside a gas zone
+//          tier: gas tier (0..7)
+//          gasType: TieredGasType value (-1 = none)
+//          nerveActive: permanent nerve effect active and not suppressed
+//
 // void OnConnect()
 //      Called on player connect; commonly used to sync admin status / initial state.
 //      Params: none
 //
+// void EEItemAttached(EntityAI item, string slot_name) / EEItemDetached(EntityAI item, string slot_name)
+//      Invalidate the cached protection snapshot when gear changes.
+//      Params: engine-provided attachment context (as named)
+//
 // void OnDisconnect()
 //      Cleanup when disconnecting.
 //      Params: none
@@ -109,22 +169,65 @@ modded class PlayerBase
     private const bool TG_STORE_MARKER = true;
     private int m_TieredGas_LastAdminRPCms;
     private const int TIEREDGAS_ADMIN_RPC_COOLDOWN_MS = 250;
+    private const int TIEREDGAS_BENCHMARK_ITERATIONS = 200;
+    private const float TIEREDGAS_REMOVE_NEAREST_MAX_DIST = 31622.0;
+    private const float TIEREDGAS_ZONE_STILL_DIST_SQ = 0.01;
 
     ref array<string> m_TG_ZonesChunks;
     int m_TG_ZonesExpected = 0;
     int m_TG_ZonesReceived = 0;
 
+    // Binary zone sync reassembly (RPC_TIERED_GAS_ZONES_SYNC_BIN)
+    ref array<ref GasZoneConfig> m_TG_BinZones;
+    ref array<bool> m_TG_BinChunksSeen;
+    int m_TG_BinVersion = -1;
+    int m_TG_BinReceived = 0;
+
+    // Server: zone set version this client was last brought up to (-1 = none / legacy JSON sync)
+    int m_TG_ZoneSyncVersion = -1;
+
+    // Server: interest streaming state (uuid -> record hash held by this client; null = client not primed)
+    ref map<string, int> m_TG_InterestZones;
+    vector m_TG_InterestPos;
+    int m_TG_InterestVersion = -1;
+
     private bool m_ClientInGas;
     private int m_ClientTier;
     private int m_ClientType;
 
     bool m_TG_ClientNerveActive = false;
 
-    bool m_TG_LastSentNerveActive = false;
-    int  m_TG_LastGasSyncMS = 0;
-
-    private float m_GasCheckTimer;
-    private const float GAS_CHECK_INTERVAL = 1.0;
+    // Replicated gas state (net sync): bit 0 in gas, bits 1-3 tier, bits 4-5 gas type + 1, bit 6 nerve active
+    int m_TG_GasNetState = 0;
+
+    int m_TG_SchedulerBucket = -1;
+    int m_TG_LastGasTickMS = 0;
+
+    ref array<int> m_TG_ZoneCandidates;
+
+    // Result of the last full zone query. m_TG_ZoneCache holds the zones whose edge was within the
+    // move threshold of m_TG_LastZoneEvalPos; no other zone can contain the player until they have
+    // moved m_TG_ZoneSafeDist away from it, the zone set changes or m_TG_NextZoneEvalMS passes.
+    int  m_TG_NextZoneEvalMS = 0;
+    vector m_TG_LastZoneEvalPos;
+    vector m_TG_LastZoneTestPos;
+    float m_TG_ZoneSafeDist = 0;
+    ref array<int> m_TG_ZoneCache;
+    int  m_TG_ZoneEvalVersion = -1;
+    int  m_TG_ZoneBestTier = 0;
+    int  m_TG_ZoneBestType = -1;
+    bool m_TG_ZoneBestMask = false;
+
+    // Zones this player is registered in and the strongest one (m_TG_ZoneBest* above is resolved by
+    // TieredGasOccupancy), exposure waiting for TieredGasOccupancy.DispatchDamage, and the scratch list
+    // reused by the containment test.
+    ref array<string> m_TG_OccupiedZones;
+    string m_TG_ZoneBestUUID;
+    float m_TG_PendingGasSeconds = 0;
+    ref array<TieredGasRuntimeZone> m_TG_InsideScratch;
+
+    // Cached gear protection state (TieredGasProtection.GetSnapshot), invalidated by the attach hooks below.
+    ref TieredGasProtectionSnapshot m_TG_Protection;
 
     int m_TG_NextBleedRollMS = 0;
     int m_TG_NextBioRollMS = 0;
@@ -203,6 +306,7 @@ modded class PlayerBase
             case RPC_ADMIN_RELOAD_CONFIG:
             case RPC_ADMIN_RELOAD_ADMINS:
             case RPC_ADMIN_RELOAD_ZONES:
+            case RPC_ADMIN_BENCHMARK_ZONES:
             {
                 if (!TieredGasAdminList.IsAdmin(this))
                 {
@@ -218,6 +322,122 @@ modded class PlayerBase
         return false;
     }
 
+    void TG_HandleBinaryZoneSync(ParamsReadContext ctx)
+    {
+        int version, hash, idx, total;
+        array<ref GasZoneConfig> decoded = new array<ref GasZoneConfig>;
+
+        if (!TieredGasZoneSyncCodec.ReadChunk(ctx, version, hash, idx, total, decoded))
+        {
+            TieredGasLog.LogError("[TieredGas] ZONES_SYNC_BIN read failed (format mismatch or truncated chunk)");
+            return;
+        }
+
+        if (TieredGasLog.IsEnabled(TieredGasLogLevel.TRACE))
+            TieredGasLog.LogTrace("[TieredGas] ZONES_SYNC_BIN recv chunk idx=" + idx + " total=" + total + " records=" + decoded.Count());
+
+        // A chunk of a newer payload drops any partially received older one.
+        if (!m_TG_BinZones || m_TG_BinVersion != version || !m_TG_BinChunksSeen || m_TG_BinChunksSeen.Count() != total)
+        {
+            m_TG_BinZones = new array<ref GasZoneConfig>;
+            m_TG_BinChunksSeen = new array<bool>;
+            m_TG_BinChunksSeen.Resize(total);
+            m_TG_BinVersion = version;
+            m_TG_BinReceived = 0;
+        }
+
+        if (idx < 0 || idx >= total || m_TG_BinChunksSeen[idx]) return;
+
+        m_TG_BinChunksSeen[idx] = true;
+        m_TG_BinReceived++;
+        foreach (GasZoneConfig cfg : decoded)
+        {
+            m_TG_BinZones.Insert(cfg);
+        }
+
+        if (m_TG_BinReceived < total) return;
+
+        array<ref GasZoneConfig> zones = m_TG_BinZones;
+        m_TG_BinZones = null;
+        m_TG_BinChunksSeen = null;
+        m_TG_BinReceived = 0;
+
+        if (TieredGasLog.IsEnabled(TieredGasLogLevel.DEBUG))
+            TieredGasLog.LogDebug("[TieredGas] ZONES_SYNC OK (" + zones.Count() + " zones) [binary v" + version + "]");
+
+        TieredGasZoneSpawner.ApplyClientZoneSync(zones);
+        TieredGasZoneSpawner.s_ClientZoneVersion = version;
+        TieredGasZoneCache.Save(hash);
+    }
+
+    void TG_HandleZoneInterest(ParamsReadContext ctx)
+    {
+        bool reset;
+        int fromVersion, toVersion, hash;
+        array<string> removals = new array<string>;
+        array<ref GasZoneConfig> upserts = new array<ref GasZoneConfig>;
+
+        if (!ctx.Read(reset) || !TieredGasZoneDelta.Read(ctx, fromVersion, toVersion, hash, removals, upserts))
+        {
+            TieredGasLog.LogError("[TieredGas] ZONES_INTEREST read failed (format mismatch or truncated)");
+            return;
+        }
+
+        if (TieredGasLog.IsEnabled(TieredGasLogLevel.DEBUG))
+            TieredGasLog.LogDebug("[TieredGas] ZONES_INTEREST +" + upserts.Count() + " -" + removals.Count() + " reset=" + reset);
+
+        if (reset)
+            TieredGasZoneSpawner.ApplyClientZoneSync(upserts);
+        else
+            TieredGasZoneSpawner.ApplyClientZoneDelta(upserts, removals);
+
+        // A partial zone set has no global version and must not overwrite the persistent cache.
+        TieredGasZoneSpawner.s_ClientZoneVersion = -1;
+    }
+
+    void TG_HandleZonesUnchanged(ParamsReadContext ctx)
+    {
+        Param2<int, int> p;
+        if (!ctx.Read(p)) return;
+
+        array<ref GasZoneConfig> zones = new array<ref GasZoneConfig>;
+        if (!TieredGasZoneCache.Load(p.param2, zones))
+        {
+            TieredGasLog.LogWarn("[TieredGas] ZONES_UNCHANGED but no matching local cache, requesting full sync");
+            GetGame().RPCSingleParam(this, RPC_TIERED_GAS_ZONES_REQUEST, null, true, GetIdentity());
+            return;
+        }
+
+        if (TieredGasLog.IsEnabled(TieredGasLogLevel.DEBUG))
+            TieredGasLog.LogDebug("[TieredGas] ZONES_UNCHANGED -> applying " + zones.Count() + " cached zones");
+
+        TieredGasZoneSpawner.ApplyClientZoneSync(zones);
+        TieredGasZoneSpawner.s_ClientZoneVersion = p.param1;
+    }
+
+    void TG_HandleZoneDelta(ParamsReadContext ctx)
+    {
+        int fromVersion, toVersion, hash;
+        array<string> removals = new array<string>;
+        array<ref GasZoneConfig> upserts = new array<ref GasZoneConfig>;
+
+        bool ok = TieredGasZoneDelta.Read(ctx, fromVersion, toVersion, hash, removals, upserts);
+        if (!ok || fromVersion != TieredGasZoneSpawner.s_ClientZoneVersion)
+        {
+            TieredGasLog.LogWarn("[TieredGas] ZONES_DELTA " + fromVersion + " -> " + toVersion + " does not apply (local v" + TieredGasZoneSpawner.s_ClientZoneVersion + "), requesting full sync");
+            TieredGasZoneSpawner.s_ClientZoneVersion = -1;
+            GetGame().RPCSingleParam(this, RPC_TIERED_GAS_ZONES_REQUEST, null, true, GetIdentity());
+            return;
+        }
+
+        if (TieredGasLog.IsEnabled(TieredGasLogLevel.DEBUG))
+            TieredGasLog.LogDebug("[TieredGas] ZONES_DELTA OK v" + fromVersion + " -> v" + toVersion + " upserts=" + upserts.Count() + " removals=" + removals.Count());
+
+        TieredGasZoneSpawner.ApplyClientZoneDelta(upserts, removals);
+        TieredGasZoneSpawner.s_ClientZoneVersion = toVersion;
+        TieredGasZoneCache.Save(hash);
+    }
+
     void TieredGas_HandleAdminCommand(int rpc_type, ParamsReadContext ctx)
     {
         switch (rpc_type)
@@ -256,6 +476,10 @@ modded class PlayerBase
                 TieredGas_ReloadZones_Server();
                 return;
 
+            case RPC_ADMIN_BENCHMARK_ZONES:
+                TieredGas_BenchmarkZones_Server();
+                return;
+
             case RPC_ADMIN_SPAWN_ZONE:
             {
                 ref TieredGasSpawnPayload p;
@@ -313,6 +537,7 @@ modded class PlayerBase
             string line = "- " + cfg.uuid + " | " + cfg.name + " | Tier " + cfg.tier.ToString() + " | R " + cfg.radius.ToString() + " | " + cfg.position;
             if (cfg.colorId != "") { line = line + " | Color " + cfg.colorId; }
             if (cfg.density != "") { line = line + " | Density " + cfg.density; }
+            line = line + " | Players " + TieredGasOccupancy.GetOccupantCount(cfg.uuid).ToString();
             SendAdminMessage(line, false);
         }
     }
@@ -347,9 +572,7 @@ modded class PlayerBase
         cfg.position = pos[0].ToString() + "," + pos[1].ToString() + "," + pos[2].ToString();
 
         TieredGasZoneSpawner.m_GasZones.Insert(cfg);
-        TieredGasJSON.SaveZonesToJSON(TieredGasZoneSpawner.m_GasZones);
-
-        TieredGasZoneSpawner.BroadcastZonesToAll();
+        TieredGasZoneSpawner.NotifyZonesChanged(true);
         SendAdminMessage("[TieredGas] Added zone: " + cfg.uuid + " (" + cfg.name + ")", false);
     }
 
@@ -393,22 +616,7 @@ modded class PlayerBase
 
         vector pPos = GetPosition();
 
-        int bestIdx = -1;
-        float bestDistSq = 999999999.0;
-
-        for (int i = 0; i < zones.Count(); i++)
-        {
-            GasZoneConfig cfg = zones[i];
-            vector zPos = TieredGasZoneSpawner.ParsePositionString(cfg.position);
-            zPos[1] = GetGame().SurfaceY(zPos[0], zPos[2]) - cfg.bottomOffset;
-
-            float d = vector.DistanceSq(pPos, zPos);
-            if (d < bestDistSq)
-            {
-                bestDistSq = d;
-                bestIdx = i;
-            }
-        }
+        int bestIdx = TieredGasZoneSpawner.FindNearestZoneIndex(pPos, TIEREDGAS_REMOVE_NEAREST_MAX_DIST, true);
 
         if (bestIdx < 0)
         {
@@ -420,9 +628,7 @@ modded class PlayerBase
         string name = zones[bestIdx].name;
 
         zones.Remove(bestIdx);
-        TieredGasJSON.SaveZonesToJSON(zones);
-
-        TieredGasZoneSpawner.BroadcastZonesToAll();
+        TieredGasZoneSpawner.NotifyZonesChanged(true);
         SendAdminMessage("[TieredGas] Removed zone: " + uuid + " (" + name + ")", false);
     }
 
@@ -530,6 +736,8 @@ modded class PlayerBase
     void TieredGas_ReloadConfig_Server()
     {
         TieredGasJSON.Load(true);
+        TieredGasLog.Load(true);
+        TieredGasServerScheduler.Init();
         SendAdminMessage("[TieredGas] Config reloaded", false);
     }
 
@@ -537,6 +745,9 @@ modded class PlayerBase
     {
         if (!GetGame().IsServer()) { return; }
 
+        // Edits still inside the broadcast quiet window would otherwise be dropped by the reload.
+        TieredGasZoneSpawner.FlushPendingSave();
+
         if (!TieredGasZoneSpawner.m_GasZones)
             TieredGasZoneSpawner.m_GasZones = new array<ref GasZoneConfig>;
 
@@ -550,10 +761,32 @@ modded class PlayerBase
         }
 
         TieredGasZoneSpawner.UpgradeZonesIfNeeded();
-        TieredGasZoneSpawner.BroadcastZonesToAll();
+        TieredGasZoneSpawner.NotifyZonesChanged();
         SendAdminMessage("[TieredGas] Zones reloaded", false);
     }
 
+    void TieredGas_BenchmarkZones_Server()
+    {
+        if (!GetGame().IsServer()) { return; }
+
+        array<vector> samples = new array<vector>;
+        array<Man> players = new array<Man>;
+        GetGame().GetPlayers(players);
+        foreach (Man m : players)
+        {
+            if (m) { samples.Insert(m.GetPosition()); }
+        }
+
+        array<string> lines = new array<string>;
+        TieredGasZoneSpawner.BenchmarkZoneQueries(samples, TIEREDGAS_BENCHMARK_ITERATIONS, lines);
+
+        foreach (string line : lines)
+        {
+            Print(line);
+            SendAdminMessage(line, false);
+        }
+    }
+
     void SendAdminMessage(string msg, bool isError)
     {
         if (!GetIdentity()) { return; }
@@ -576,11 +809,44 @@ modded class PlayerBase
         {
             if (GetGame().IsServer())
             {
-                TieredGasZoneSpawner.SendZonesToPlayer(this);
+                // Join requests carry the hash of the client's cached zone set; manual resyncs carry nothing.
+                Param1<int> req;
+                bool hasHash = ctx.Read(req);
+                int clientHash = 0;
+                if (hasHash) clientHash = req.param1;
+                TieredGasZoneSpawner.HandleZonesRequest(this, hasHash, clientHash);
             }
             return;
         }
 
+        if (rpc_type == RPC_TIERED_GAS_ZONES_SYNC_BIN)
+        {
+            if (GetGame().IsServer()) return;
+            TG_HandleBinaryZoneSync(ctx);
+            return;
+        }
+
+        if (rpc_type == RPC_TIERED_GAS_ZONES_DELTA)
+        {
+            if (GetGame().IsServer()) return;
+            TG_HandleZoneDelta(ctx);
+            return;
+        }
+
+        if (rpc_type == RPC_TIERED_GAS_ZONES_INTEREST)
+        {
+            if (GetGame().IsServer()) return;
+            TG_HandleZoneInterest(ctx);
+            return;
+        }
+
+        if (rpc_type == RPC_TIERED_GAS_ZONES_UNCHANGED)
+        {
+            if (GetGame().IsServer()) return;
+            TG_HandleZonesUnchanged(ctx);
+            return;
+        }
+
         if (rpc_type == RPC_TIERED_GAS_ZONES_SYNC)
         {
             if (GetGame().IsServer()) return;
@@ -592,7 +858,8 @@ modded class PlayerBase
                 int total = p3.param2;
                 string chunk = p3.param3;
 
-                Print("[TieredGas] ZONES_SYNC recv chunk idx=" + idx + " total=" + total + " len=" + chunk.Length().ToString());
+                if (TieredGasLog.IsEnabled(TieredGasLogLevel.TRACE))
+                    TieredGasLog.LogTrace("[TieredGas] ZONES_SYNC recv chunk idx=" + idx + " total=" + total + " len=" + chunk.Length().ToString());
 
                 if (!m_TG_ZonesChunks || m_TG_ZonesExpected != total)
                 {
@@ -621,12 +888,14 @@ modded class PlayerBase
 
                     if (!TieredGasJSON.ZonesFromChunks(chunks, zones, err))
                     {
-                        Print("[TieredGas] ZONES_SYNC JSON parse failed: " + err);
+                        TieredGasLog.LogError("[TieredGas] ZONES_SYNC JSON parse failed: " + err);
                         return;
                     }
 
-                    Print("[TieredGas] ZONES_SYNC OK (" + zones.Count() + " zones) [chunked]");
+                    if (TieredGasLog.IsEnabled(TieredGasLogLevel.DEBUG))
+                        TieredGasLog.LogDebug("[TieredGas] ZONES_SYNC OK (" + zones.Count() + " zones) [chunked]");
                     TieredGasZoneSpawner.ApplyClientZoneSync(zones);
+                    TieredGasZoneSpawner.s_ClientZoneVersion = -1;
                 }
                 return;
             }
@@ -641,35 +910,20 @@ modded class PlayerBase
 
                 if (!TieredGasJSON.ZonesFromJsonString(jsonStrLegacy, zones2, err2))
                 {
-                    Print("[TieredGas] ZONES_SYNC legacy JSON parse failed: " + err2);
+                    TieredGasLog.LogError("[TieredGas] ZONES_SYNC legacy JSON parse failed: " + err2);
                     return;
                 }
 
-                Print("[TieredGas] ZONES_SYNC OK (" + zones2.Count() + " zones) [legacy]");
+                if (TieredGasLog.IsEnabled(TieredGasLogLevel.DEBUG))
+                    TieredGasLog.LogDebug("[TieredGas] ZONES_SYNC OK (" + zones2.Count() + " zones) [legacy]");
                 TieredGasZoneSpawner.ApplyClientZoneSync(zones2);
+                TieredGasZoneSpawner.s_ClientZoneVersion = -1;
                 return;
             }
 
-            Print("[TieredGas] ZONES_SYNC read failed (wrong rpc payload/type)");
-            return;
-        }
-        if (rpc_type == RPC_TIERED_GAS_UPDATE)
-        {
-            Param4<bool, int, int, bool> data4;
-            if (ctx.Read(data4))
-            {
-                SetGasHUD(data4.param1, data4.param2, data4.param3);
-                m_TG_ClientNerveActive = data4.param4;
-                return;
-            }
-
-            Param3<bool, int, int> data3;
-            if (!ctx.Read(data3)) { return; }
-
-            SetGasHUD(data3.param1, data3.param2, data3.param3);
+            TieredGasLog.LogWarn("[TieredGas] ZONES_SYNC read failed (wrong rpc payload/type)");
             return;
         }
-
         if (TieredGas_HandleAdminRPC(sender, rpc_type, ctx)) { return; }
     }
 
@@ -683,14 +937,85 @@ modded class PlayerBase
         }
         if (!GetGame().IsServer()) { return; }
 
-        m_GasCheckTimer += deltaTime;
-        if (m_GasCheckTimer < GAS_CHECK_INTERVAL) { return; }
+        // Gas work itself runs from TieredGasServerScheduler; this only makes sure we are enrolled.
+        if (m_TG_SchedulerBucket < 0 && IsAlive())
+        {
+            TieredGasServerScheduler.Register(this);
+        }
+    }
 
-        float tick = m_GasCheckTimer;
-        m_GasCheckTimer = 0;
+    void TG_ServerGasTick(float tickDelta)
+    {
+        ProcessTieredGasZones(tickDelta);
+        TG_ApplyPersistentEffects(tickDelta);
+        TieredGasZoneSpawner.UpdatePlayerInterest(this, false);
+    }
 
-        ProcessTieredGasZones(tick);
-        TG_ApplyPersistentEffects(tick);
+    override void EEItemAttached(EntityAI item, string slot_name)
+    {
+        super.EEItemAttached(item, slot_name);
+        TieredGasProtection.Invalidate(this);
+    }
+
+    override void EEItemDetached(EntityAI item, string slot_name)
+    {
+        super.EEItemDetached(item, slot_name);
+        TieredGasProtection.Invalidate(this);
+    }
+
+    override void EEKilled(Object killer)
+    {
+        if (GetGame().IsServer())
+        {
+            TieredGasServerScheduler.Unregister(this);
+            TieredGasOccupancy.RemovePlayer(this);
+        }
+        super.EEKilled(killer);
+    }
+
+    override void EEDelete(EntityAI parent)
+    {
+        if (GetGame().IsServer())
+        {
+            TieredGasServerScheduler.Unregister(this);
+            TieredGasOccupancy.RemovePlayer(this);
+        }
+        super.EEDelete(parent);
+    }
+
+    override void OnDisconnect()
+    {
+        if (GetGame().IsServer())
+        {
+            TieredGasServerScheduler.Unregister(this);
+            TieredGasOccupancy.RemovePlayer(this);
+        }
+        super.OnDisconnect();
+    }
+
+    override void Init()
+    {
+        super.Init();
+        RegisterNetSyncVariableInt("m_TG_GasNetState", 0, 127);
+    }
+
+    override void OnVariablesSynchronized()
+    {
+        super.OnVariablesSynchronized();
+
+        int s = m_TG_GasNetState;
+        SetGasHUD((s & 1) != 0, (s >> 1) & 0x7, ((s >> 4) & 0x3) - 1);
+        m_TG_ClientNerveActive = (s & (1 << 6)) != 0;
+    }
+
+    static int TG_PackGasNetState(bool inGas, int tier, int gasType, bool nerveActive)
+    {
+        int s = 0;
+        if (inGas) s |= 1;
+        s |= (tier & 0x7) << 1;
+        s |= ((gasType + 1) & 0x3) << 4;
+        if (nerveActive) s |= 1 << 6;
+        return s;
     }
 
     override void EEInit()
@@ -708,81 +1033,114 @@ void TG_RestorePersistentState()
 }
 
 
-    void ProcessTieredGasZones(float tickDelta)
+    void TG_EvaluateZones(int nowMS)
     {
-        int bestTier = 0;
-        int bestType = -1;
-        bool bestMaskRequired = false;
+        // Anything further than this cannot be reached before the capped recheck anyway.
+        float searchRadius = TieredGasJSON.GetAdaptiveSearchRadius();
+        float moveThreshold = TieredGasJSON.GetZoneCacheMoveThreshold();
+        float safeDist = searchRadius;
 
         vector p = GetPosition();
 
-        array<ref GasZoneConfig> zones = TieredGasZoneSpawner.m_GasZones;
+        if (!m_TG_ZoneCandidates) { m_TG_ZoneCandidates = new array<int>; }
+        if (!m_TG_ZoneCache) { m_TG_ZoneCache = new array<int>; }
+        m_TG_ZoneCache.Clear();
+
+        array<ref TieredGasRuntimeZone> zones = TieredGasZoneSpawner.s_RuntimeZones;
         if (zones)
         {
-            foreach (GasZoneConfig cfg : zones)
+            TieredGasZoneSpawner.GetZoneCandidates(p, searchRadius, m_TG_ZoneCandidates);
+
+            foreach (int zi : m_TG_ZoneCandidates)
             {
-                if (!cfg) { continue; }
+                TieredGasRuntimeZone rz = zones[zi];
+
+                // Horizontal distance only: never larger than the true distance to the zone volume.
+                float dx = p[0] - rz.center[0];
+                float dz = p[2] - rz.center[2];
+                float edge = Math.Sqrt((dx * dx) + (dz * dz)) - rz.radius;
+
+                if (edge < moveThreshold)
+                    m_TG_ZoneCache.Insert(zi);
+                else if (edge < safeDist)
+                    safeDist = edge;
+            }
+        }
 
-                vector zp = TieredGasZoneSpawner.ParsePositionString(cfg.position);
-                zp[1] = GetGame().SurfaceY(zp[0], zp[2]) - cfg.bottomOffset;
+        if (safeDist < moveThreshold) safeDist = moveThreshold;
 
-                float dx = p[0] - zp[0];
-                float dz = p[2] - zp[2];
-                float hSq = (dx * dx) + (dz * dz);
+        m_TG_ZoneSafeDist = safeDist;
+        m_TG_ZoneEvalVersion = TieredGasZoneSpawner.s_ZoneSetVersion;
+        m_TG_LastZoneEvalPos = p;
+        m_TG_NextZoneEvalMS = nowMS + (TieredGasJSON.GetAdaptiveMaxRecheckSeconds() * 1000.0);
 
-                float r = cfg.radius;
-                if (hSq > (r * r)) { continue; }
+        TG_TestCachedZones(p);
+    }
 
-                float dy = p[1] - zp[1];
-                if (dy < 0) { continue; }
-                if (dy > (cfg.height + cfg.verticalMargin)) { continue; }
+    // Exact containment against the cached near zones only.
+    void TG_TestCachedZones(vector p)
+    {
+        if (!m_TG_InsideScratch) { m_TG_InsideScratch = new array<TieredGasRuntimeZone>; }
+        m_TG_InsideScratch.Clear();
 
-                if (cfg.tier > bestTier)
-                {
-                    bestTier = cfg.tier;
-                    bestType = cfg.gasType;
-                    bestMaskRequired = cfg.maskRequired;
-                }
+        array<ref TieredGasRuntimeZone> zones = TieredGasZoneSpawner.s_RuntimeZones;
+        if (zones && m_TG_ZoneCache)
+        {
+            foreach (int zi : m_TG_ZoneCache)
+            {
+                TieredGasRuntimeZone rz = zones[zi];
+                if (rz.Contains(p)) { m_TG_InsideScratch.Insert(rz); }
             }
         }
 
-        bool inGas = (bestTier > 0);
-        bool nerveActiveNow = (m_TG_NervePermanent && !TG_IsNerveSuppressed());
-        if (inGas && bestType < 0) { bestType = 0; }
+        m_TG_LastZoneTestPos = p;
 
-                int nowMS = GetGame().GetTime();
-        bool needSync = false;
+        TieredGasOccupancy.UpdatePlayer(this, m_TG_InsideScratch);
+    }
 
-        if (inGas != m_ClientInGas || bestTier != m_ClientTier || bestType != m_ClientType)
-        {
-            needSync = true;
-        }
+    void ProcessTieredGasZones(float tickDelta)
+    {
+        int nowMS = GetGame().GetTime();
+        vector pos = GetPosition();
+
+        bool fullDue = (nowMS >= m_TG_NextZoneEvalMS || m_TG_ZoneEvalVersion != TieredGasZoneSpawner.s_ZoneSetVersion);
+        if (!fullDue && vector.DistanceSq(pos, m_TG_LastZoneEvalPos) >= m_TG_ZoneSafeDist * m_TG_ZoneSafeDist)
+            fullDue = true;
 
-        if (nerveActiveNow != m_TG_LastSentNerveActive)
+        if (fullDue)
         {
-            needSync = true;
+            TG_EvaluateZones(nowMS);
         }
-
-        if (!needSync && (nowMS - m_TG_LastGasSyncMS) >= 5000)
+        else if (m_TG_ZoneCache && m_TG_ZoneCache.Count() > 0 && vector.DistanceSq(pos, m_TG_LastZoneTestPos) > TIEREDGAS_ZONE_STILL_DIST_SQ)
         {
-            needSync = true;
+            TG_TestCachedZones(pos);
         }
 
-        if (needSync)
-        {
-            SetGasHUD(inGas, bestTier, bestType);
+        int bestTier = m_TG_ZoneBestTier;
+        int bestType = m_TG_ZoneBestType;
 
-            if (GetIdentity())
-            {
-                GetGame().RPCSingleParam(this, RPC_TIERED_GAS_UPDATE, new Param4<bool,int,int,bool>(inGas, bestTier, bestType, nerveActiveNow), true, GetIdentity());
-                m_TG_LastSentNerveActive = nerveActiveNow;
-                m_TG_LastGasSyncMS = nowMS;
-            }
+        bool inGas = (bestTier > 0);
+        bool nerveActiveNow = (m_TG_NervePermanent && !TG_IsNerveSuppressed());
+        if (inGas && bestType < 0) { bestType = 0; }
+
+        SetGasHUD(inGas, bestTier, bestType);
+
+        // Replicated only when the packed value actually changes; no heartbeat needed.
+        int netState = TG_PackGasNetState(inGas, bestTier, bestType, nerveActiveNow);
+        if (netState != m_TG_GasNetState)
+        {
+            m_TG_GasNetState = netState;
+            SetSynchDirty();
         }
 
+        // Damage itself is dispatched per occupied zone by TieredGasOccupancy after this frame's ticks.
         if (inGas)
         {
-            ApplyTieredGasDamage(this, tickDelta, bestTier, bestType, bestMaskRequired);
+            TieredGasOccupancy.QueueDamage(this, tickDelta);
+        }
+        else
+        {
+            m_TG_PendingGasSeconds = 0;
         }
     }
     bool TG_CanRollBleedNow()
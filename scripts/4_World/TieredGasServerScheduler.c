@@ -0,0 +1,194 @@
+//---------------------------------------------------------------------------------------------------
+// scripts/4_World/TieredGasServerScheduler.c
+//
+// File summary: Server-side owner of the per-player gas tick. Players are spread across phase buckets
+//               (least-filled bucket on registration) so players that joined together do not all run
+//               their zone evaluation on the same frame. Buckets are drained round-robin, each frame
+//               capped by a per-frame budget; every player keeps an exact elapsed time since its own
+//               previous tick so damage and filter drain are unchanged.
+//
+// TieredGasServerScheduler
+//
+// void Init()
+//      (Re)builds the buckets from GasSettings.json and re-registers any tracked players.
+//      Params: none
+//
+// void Register(PlayerBase player)
+//      Adds a player to the least-filled bucket (no-op if already registered).
+//      Params:
+//          player: player to schedule
+//
+// void Unregister(PlayerBase player)
+//      Removes a player from its bucket.
+//      Params:
+//          player: player to drop
+//
+// void OnUpdate(float timeslice)
+//      Per-frame driver: ticks due players of the current bucket(s) up to the frame budget, then lets
+//      TieredGasOccupancy dispatch the damage those ticks queued.
+//      Params:
+//          timeslice: frame delta time (unused; timing is absolute so per-player deltas stay exact)
+//
+// void Cleanup()
+//      Drops all buckets (mission finish).
+//      Params: none
+//---------------------------------------------------------------------------------------------------
+
+class TieredGasServerScheduler
+{
+    static const int GAS_TICK_INTERVAL_MS = 1000;
+
+    static ref array<ref array<PlayerBase>> s_Buckets;
+    static ref array<int> s_BucketDueMS;
+
+    static int s_Cursor;
+    static int s_CursorPos;
+
+    static void Init()
+    {
+        if (!GetGame().IsServer()) return;
+
+        array<PlayerBase> tracked = new array<PlayerBase>;
+        if (s_Buckets)
+        {
+            foreach (array<PlayerBase> oldBucket : s_Buckets)
+            {
+                if (!oldBucket) continue;
+                foreach (PlayerBase op : oldBucket)
+                {
+                    if (op) tracked.Insert(op);
+                }
+            }
+        }
+
+        int count = TieredGasJSON.GetSchedulerBuckets();
+        int now = GetGame().GetTime();
+
+        s_Buckets = new array<ref array<PlayerBase>>;
+        s_BucketDueMS = new array<int>;
+
+        for (int b = 0; b < count; b++)
+        {
+            s_Buckets.Insert(new array<PlayerBase>);
+            s_BucketDueMS.Insert(now + ((b + 1) * GAS_TICK_INTERVAL_MS) / count);
+        }
+
+        s_Cursor = 0;
+        s_CursorPos = 0;
+
+        foreach (PlayerBase p : tracked)
+        {
+            p.m_TG_SchedulerBucket = -1;
+            Register(p);
+        }
+    }
+
+    static void Register(PlayerBase player)
+    {
+        if (!player || !GetGame().IsServer()) return;
+        if (player.m_TG_SchedulerBucket >= 0) return;
+        if (!s_Buckets) Init();
+
+        int best = 0;
+        for (int b = 1; b < s_Buckets.Count(); b++)
+        {
+            if (s_Buckets[b].Count() < s_Buckets[best].Count())
+                best = b;
+        }
+
+        s_Buckets[best].Insert(player);
+        player.m_TG_SchedulerBucket = best;
+        player.m_TG_LastGasTickMS = GetGame().GetTime();
+    }
+
+    static void Unregister(PlayerBase player)
+    {
+        if (!player || !s_Buckets) return;
+
+        int b = player.m_TG_SchedulerBucket;
+        player.m_TG_SchedulerBucket = -1;
+        if (b < 0 || b >= s_Buckets.Count()) return;
+
+        array<PlayerBase> bucket = s_Buckets[b];
+        int idx = bucket.Find(player);
+        if (idx < 0) return;
+
+        bucket.RemoveOrdered(idx);
+        if (b == s_Cursor && idx < s_CursorPos) s_CursorPos--;
+    }
+
+    static void OnUpdate(float timeslice)
+    {
+        DrainBuckets();
+        TieredGasOccupancy.DispatchDamage();
+    }
+
+    protected static void DrainBuckets()
+    {
+        if (!s_Buckets || s_Buckets.Count() == 0) return;
+
+        int now = GetGame().GetTime();
+        int budget = TieredGasJSON.GetSchedulerMaxPlayersPerFrame();
+        int bucketCount = s_Buckets.Count();
+        int guard = bucketCount;
+
+        while (budget > 0 && guard > 0)
+        {
+            if (now < s_BucketDueMS[s_Cursor]) return;
+
+            array<PlayerBase> bucket = s_Buckets[s_Cursor];
+            while (s_CursorPos < bucket.Count() && budget > 0)
+            {
+                PlayerBase p = bucket[s_CursorPos];
+                if (!p)
+                {
+                    bucket.RemoveOrdered(s_CursorPos);
+                    continue;
+                }
+
+                s_CursorPos++;
+                TickPlayer(p, now);
+                budget--;
+            }
+
+            if (s_CursorPos < bucket.Count()) return;
+
+            int due = s_BucketDueMS[s_Cursor] + GAS_TICK_INTERVAL_MS;
+            if (due <= now - GAS_TICK_INTERVAL_MS) due = now + GAS_TICK_INTERVAL_MS;
+            s_BucketDueMS[s_Cursor] = due;
+
+            s_Cursor = (s_Cursor + 1) % bucketCount;
+            s_CursorPos = 0;
+            guard--;
+        }
+    }
+
+    protected static void TickPlayer(PlayerBase p, int now)
+    {
+        int elapsedMS = now - p.m_TG_LastGasTickMS;
+        if (elapsedMS <= 0) return;
+
+        p.m_TG_LastGasTickMS = now;
+        p.TG_ServerGasTick(elapsedMS / 1000.0);
+    }
+
+    static void Cleanup()
+    {
+        if (s_Buckets)
+        {
+            foreach (array<PlayerBase> bucket : s_Buckets)
+            {
+                if (!bucket) continue;
+                foreach (PlayerBase p : bucket)
+                {
+                    if (p) p.m_TG_SchedulerBucket = -1;
+                }
+            }
+        }
+
+        s_Buckets = null;
+        s_BucketDueMS = null;
+        s_Cursor = 0;
+        s_CursorPos = 0;
+    }
+};
@@ -0,0 +1,421 @@
+//---------------------------------------------------------------------------------------------------
+// scripts/4_World/TieredGasVisualManager.c
+//
+// File summary: Client-side owner of zone visual ticks (cloud spawn/LOD/despawn, player-local particle).
+//               Replaces one Timer per TieredGasZone: zones register here, a grid index finds the ones
+//               within cloud despawn range of the player, and only those (plus zones that still own
+//               particles) are considered. A pass starts every VISUAL_CHECK_SECONDS (0.25 s) and ticks
+//               its due zones nearest first, ZONES_PER_FRAME per frame. Cadence is tiered by distance
+//               from the player to the zone edge:
+//                 <= NEAR_TICK_DIST (250 m)  every pass
+//                 <= MID_TICK_DIST (800 m)   every MID_TICK_MS (1 s)
+//                 further / out of range     every FAR_TICK_MS (2 s)
+//               A zone whose view-cull state flips is ticked in that pass regardless of its tier.
+//
+//               Cloud emitters share one client budget (maxCloudParticlesGlobal in
+//               AdvancedTieredGasSetting.json): at the start of each pass, zones within despawn range are
+//               ordered by distance to their edge and granted slots nearest first, so far zones shrink
+//               (or drop their cloud) when near zones need the capacity. Emitters still fading out in
+//               the particle manager's stop queue count as used, so crossfades stay inside the budget.
+//
+//               Zones whose whole footprint lies outside the camera's view cone (CULL_HALF_ANGLE, which
+//               already includes a margin over the widest FOV) are marked view-culled; their emitters are
+//               paused until the zone comes back within CULL_HALF_ANGLE - CULL_HYSTERESIS. Zones the
+//               camera is inside are never culled. Culled zones are ranked after every visible zone in the
+//               budget allocation, so they only keep slots nobody visible needs and take them back
+//               (nearest first again) once they are in view.
+//
+// TieredGasVisualManager
+//
+// void Register(TieredGasZone zone)
+//      Adds a zone (or marks it moved / reconfigured); the index is rebuilt on the next pass.
+//      Zones remember their list slots, so Register / Unregister / SetActive are O(1).
+//      Params:
+//          zone: client zone object
+//
+// void Unregister(TieredGasZone zone)
+//      Removes a zone (destructor).
+//      Params:
+//          zone: client zone object
+//
+// void SetActive(TieredGasZone zone, bool active)
+//      Tracks zones that own particles so they keep being ticked (and can despawn) after leaving the
+//      near set, e.g. after a teleport.
+//      Params:
+//          zone: client zone object
+//          active: zone has a cloud or owns the player-local particle
+//
+// void OnUpdate(float timeslice)
+//      Per-frame driver: starts a pass every VISUAL_CHECK_SECONDS and ticks up to ZONES_PER_FRAME due
+//      zones, nearest first.
+//      Params:
+//          timeslice: frame delta time (unused; zones use absolute time)
+//
+// int GetTickIntervalMS(int rank)
+//      Distance-tier tick interval for a pass rank (edge distance plus cull / range offsets).
+//      Params:
+//          rank: zone rank from the pass
+//
+// bool IsOutsideView(TieredGasZone zone)
+//      View cone test for the current frame's camera, with hysteresis on the zone's current cull state.
+//      Params:
+//          zone: client zone object
+//
+// void Cleanup()
+//      Drops all tracking (mission finish).
+//      Params: none
+//---------------------------------------------------------------------------------------------------
+
+class TieredGasVisualManager
+{
+    static const int   ZONES_PER_FRAME = 8;
+    static const float REQUERY_MOVE_DIST = 100.0;
+    static const float CULL_HALF_ANGLE = 70.0;
+    static const float CULL_HYSTERESIS = 10.0;
+    static const int   CULLED_RANK_OFFSET = 1 << 18;   // above any edge distance in despawn range
+    static const int   OUT_OF_RANGE_RANK_OFFSET = 1 << 19;
+
+    // Tick cadence by edge distance: every pass (VISUAL_CHECK_SECONDS) up close, then slower.
+    static const int   NEAR_TICK_DIST = 250;
+    static const int   MID_TICK_DIST  = 800;
+    static const int   MID_TICK_MS    = 1000;
+    static const int   FAR_TICK_MS    = 2000;
+
+    static ref array<TieredGasZone> s_Zones;
+    static ref array<TieredGasZone> s_Active;
+    static ref TieredGasZoneIndex s_Index;
+    static bool s_IndexDirty;
+
+    // Zones to tick this pass, nearest first (only those whose distance tier is due).
+    static ref array<TieredGasZone> s_Work;
+    static int s_WorkCursor;
+    static int s_NextPassMS;
+    static int s_Pass;
+
+    // Candidates are queried with REQUERY_MOVE_DIST extra pad and reused until the player moved that far.
+    static ref array<int> s_Candidates;
+    static vector s_QueryPos;
+    static bool s_HasQuery;
+
+    // Camera sampled once per frame for view culling.
+    static vector s_CamPos;
+    static vector s_CamDir;
+
+    static void Register(TieredGasZone zone)
+    {
+        if (!zone) return;
+        if (!s_Zones) s_Zones = new array<TieredGasZone>;
+
+        if (zone.m_VisualSlot < 0)
+        {
+            zone.m_VisualSlot = s_Zones.Count();
+            s_Zones.Insert(zone);
+        }
+        zone.m_NextVisualTickMs = 0;   // moved / reconfigured: tick on the next pass
+        s_IndexDirty = true;
+    }
+
+    static void Unregister(TieredGasZone zone)
+    {
+        if (!zone) return;
+
+        int idx = zone.m_VisualSlot;
+        if (s_Zones && idx >= 0 && idx < s_Zones.Count() && s_Zones[idx] == zone)
+        {
+            RemoveSlot(s_Zones, idx, false);
+            s_IndexDirty = true;
+        }
+        zone.m_VisualSlot = -1;
+
+        SetActive(zone, false);
+
+        int w = zone.m_WorkSlot;
+        if (s_Work && w >= 0 && w < s_Work.Count() && s_Work[w] == zone) s_Work[w] = null;
+        zone.m_WorkSlot = -1;
+    }
+
+    static void SetActive(TieredGasZone zone, bool active)
+    {
+        if (!zone) return;
+        if (!s_Active) s_Active = new array<TieredGasZone>;
+
+        int idx = zone.m_ActiveSlot;
+        bool listed = (idx >= 0 && idx < s_Active.Count() && s_Active[idx] == zone);
+
+        if (active && !listed)
+        {
+            zone.m_ActiveSlot = s_Active.Count();
+            s_Active.Insert(zone);
+        }
+        else if (!active && listed)
+        {
+            RemoveSlot(s_Active, idx, true);
+            zone.m_ActiveSlot = -1;
+        }
+    }
+
+    // Swap-remove that keeps the moved zone's stored slot in sync.
+    protected static void RemoveSlot(array<TieredGasZone> list, int idx, bool activeList)
+    {
+        int last = list.Count() - 1;
+        TieredGasZone moved = list[last];
+        list[idx] = moved;
+        list.Remove(last);
+
+        if (!moved || idx == last) return;
+        if (activeList) moved.m_ActiveSlot = idx;
+        else moved.m_VisualSlot = idx;
+    }
+
+    static void OnUpdate(float timeslice)
+    {
+        if (!s_Zones || s_Zones.Count() == 0) return;
+
+        PlayerBase player = PlayerBase.Cast(GetGame().GetPlayer());
+        if (!player) return;
+
+        int now = GetGame().GetTime();
+        vector pos = player.GetPosition();
+
+        s_CamPos = GetGame().GetCurrentCameraPosition();
+        s_CamDir = GetGame().GetCurrentCameraDirection();
+
+        if (!s_Work || s_WorkCursor >= s_Work.Count())
+        {
+            if (now < s_NextPassMS) return;
+            s_NextPassMS = now + (TieredGasZone.VISUAL_CHECK_SECONDS * 1000.0);
+            BuildWorkList(pos, now);
+        }
+
+        int budget = ZONES_PER_FRAME;
+        while (s_WorkCursor < s_Work.Count() && budget > 0)
+        {
+            TieredGasZone zone = s_Work[s_WorkCursor];
+            s_WorkCursor++;
+            if (!zone) continue;
+
+            zone.SetViewCulled(IsOutsideView(zone));
+            zone.OnVisualTick(player, pos, now);
+            budget--;
+        }
+    }
+
+    protected static void BuildWorkList(vector pos, int now)
+    {
+        if (!s_Work) s_Work = new array<TieredGasZone>;
+        if (!s_Candidates) s_Candidates = new array<int>;
+
+        bool requery = s_IndexDirty || !s_HasQuery;
+        if (!requery && vector.DistanceSq(pos, s_QueryPos) > (REQUERY_MOVE_DIST * REQUERY_MOVE_DIST)) requery = true;
+
+        if (s_IndexDirty) RebuildIndex();
+
+        if (requery)
+        {
+            s_Index.Query(pos, TieredGasZone.CLOUD_DESPAWN_RANGE + REQUERY_MOVE_DIST, s_Candidates);
+            s_QueryPos = pos;
+            s_HasQuery = true;
+        }
+
+        s_Pass++;
+
+        // Every zone of this pass: near candidates, then active zones outside the candidate set.
+        array<TieredGasZone> passZones = new array<TieredGasZone>;
+        foreach (int id : s_Candidates)
+        {
+            TieredGasZone zone = s_Zones[id];
+            if (!zone) continue;
+
+            zone.m_VisualPass = s_Pass;
+            passZones.Insert(zone);
+        }
+
+        if (s_Active)
+        {
+            foreach (TieredGasZone az : s_Active)
+            {
+                if (az && az.m_VisualPass != s_Pass) passZones.Insert(az);
+            }
+        }
+
+        // Rank by edge distance; culled zones after visible ones, zones beyond despawn range last.
+        float rangeSq = TieredGasZone.CLOUD_DESPAWN_RANGE * TieredGasZone.CLOUD_DESPAWN_RANGE;
+        array<int> order = new array<int>;
+        array<int> ranks = new array<int>;
+        array<bool> cullChanged = new array<bool>;
+        ranks.Resize(passZones.Count());
+        cullChanged.Resize(passZones.Count());
+
+        for (int i = 0; i < passZones.Count(); i++)
+        {
+            TieredGasZone pz = passZones[i];
+            vector zp = pz.GetPosition();
+
+            float edge = vector.Distance(pos, zp) - pz.GetRadius();
+            if (edge < 0) edge = 0;
+            int rank = edge;
+
+            bool culled = IsOutsideView(pz);
+            cullChanged[i] = (culled != pz.IsViewCulled());
+            pz.SetViewCulled(culled);
+
+            if (vector.DistanceSq(pos, zp) > rangeSq) rank += OUT_OF_RANGE_RANK_OFFSET;
+            else if (culled) rank += CULLED_RANK_OFFSET;
+
+            ranks[i] = rank;
+            order.Insert(i);
+        }
+        SortByRank(order, ranks);
+
+        AllocateParticleBudget(passZones, order, ranks);
+
+        // Tick list: nearest first, only zones whose distance tier is due (or whose view state flipped).
+        s_Work.Clear();
+        s_WorkCursor = 0;
+        foreach (int pi : order)
+        {
+            TieredGasZone tz = passZones[pi];
+            if (now < tz.m_NextVisualTickMs && !cullChanged[pi]) continue;
+
+            tz.m_NextVisualTickMs = now + GetTickIntervalMS(ranks[pi]);
+            tz.m_WorkSlot = s_Work.Count();
+            s_Work.Insert(tz);
+        }
+    }
+
+    // Rank = edge distance (m) plus the culled / out-of-range offsets.
+    static int GetTickIntervalMS(int rank)
+    {
+        int edge = rank % CULLED_RANK_OFFSET;
+        if (edge <= NEAR_TICK_DIST) return 0;
+        if (edge <= MID_TICK_DIST) return MID_TICK_MS;
+        return FAR_TICK_MS;
+    }
+
+    protected static void AllocateParticleBudget(array<TieredGasZone> zones, array<int> order, array<int> ranks)
+    {
+        int remaining = TG_AdvancedTieredGasSettingMgr.GetGlobalParticleBudget() - TieredGasParticleManager.GetRetiringCount();
+        if (remaining < 0) remaining = 0;
+
+        foreach (int zi : order)
+        {
+            TieredGasZone z = zones[zi];
+            if (ranks[zi] >= OUT_OF_RANGE_RANK_OFFSET)
+            {
+                z.SetCloudBudget(0);
+                continue;
+            }
+
+            int grant = z.GetCloudDemand();
+            if (grant > remaining) grant = remaining;
+
+            z.SetCloudBudget(grant);
+            remaining -= grant;
+        }
+    }
+
+    // Stable bottom-up merge sort of indices by ranks[index] (ascending).
+    protected static void SortByRank(array<int> order, array<int> ranks)
+    {
+        int n = order.Count();
+        array<int> src = order;
+        array<int> dst = new array<int>;
+        dst.Resize(n);
+
+        for (int width = 1; width < n; width *= 2)
+        {
+            for (int lo = 0; lo < n; lo += 2 * width)
+            {
+                int mid = lo + width;
+                if (mid > n) mid = n;
+                int hi = lo + (2 * width);
+                if (hi > n) hi = n;
+
+                int a = lo;
+                int b = mid;
+                for (int k = lo; k < hi; k++)
+                {
+                    if (a < mid && (b >= hi || ranks[src[a]] <= ranks[src[b]]))
+                    {
+                        dst[k] = src[a];
+                        a++;
+                    }
+                    else
+                    {
+                        dst[k] = src[b];
+                        b++;
+                    }
+                }
+            }
+
+            array<int> swap = src;
+            src = dst;
+            dst = swap;
+        }
+
+        if (src != order) order.Copy(src);
+    }
+
+    static bool IsOutsideView(TieredGasZone zone)
+    {
+        vector to = zone.GetPosition() - s_CamPos;
+        float d = to.Length();
+        float r = zone.GetRadius();
+        if (d <= r || d < 0.01) return false;
+
+        float cosA = vector.Dot(to, s_CamDir) / d;
+        if (cosA > 1.0) cosA = 1.0;
+        if (cosA < -1.0) cosA = -1.0;
+
+        // Angle from the view axis to the nearest edge of the zone's footprint.
+        float off = (Math.Acos(cosA) - Math.Asin(r / d)) * Math.RAD2DEG;
+
+        float limit = CULL_HALF_ANGLE;
+        if (zone.IsViewCulled()) limit = CULL_HALF_ANGLE - CULL_HYSTERESIS;
+        return off > limit;
+    }
+
+    protected static void RebuildIndex()
+    {
+        if (!s_Index) s_Index = new TieredGasZoneIndex();
+        s_Index.Clear();
+
+        for (int i = s_Zones.Count() - 1; i >= 0; i--)
+        {
+            if (!s_Zones[i]) RemoveSlot(s_Zones, i, false);
+        }
+
+        for (int z = 0; z < s_Zones.Count(); z++)
+        {
+            s_Index.Insert(z, s_Zones[z].GetPosition(), s_Zones[z].GetRadius());
+        }
+
+        s_IndexDirty = false;
+        s_HasQuery = false;
+    }
+
+    static void Cleanup()
+    {
+        if (s_Zones)
+        {
+            foreach (TieredGasZone zone : s_Zones)
+            {
+                if (!zone) continue;
+                zone.m_VisualSlot = -1;
+                zone.m_ActiveSlot = -1;
+                zone.m_WorkSlot = -1;
+                zone.m_NextVisualTickMs = 0;
+            }
+        }
+
+        s_Zones = null;
+        s_Active = null;
+        s_Index = null;
+        s_Work = null;
+        s_Candidates = null;
+        s_WorkCursor = 0;
+        s_NextPassMS = 0;
+        s_HasQuery = false;
+        s_IndexDirty = false;
+    }
+};
@@ -41,6 +41,18 @@
 //          radius: zone radius
 //          dens: density ID/string
 //
+// int GetGlobalParticleBudget()
+//      Client-wide cap on live cloud emitters across all zones (maxCloudParticlesGlobal).
+//      Params: none
+//
+// int GetCloudEmittersPerFrame()
+//      Cloud emitters TieredGasParticleManager may start (and stop) per frame (cloudEmittersPerFrame).
+//      Params: none
+//
+// int GetCloudEmitterPoolSize()
+//      Stopped cloud emitters kept for reuse (cloudEmitterPoolSize, 0 disables the pool).
+//      Params: none
+//
 //
 // TieredGasZone : BuildingBase
 //
@@ -53,20 +65,24 @@
 //      Applies config fields to this zone instance.
 //      Params: (each is the zone config field as named)
 //
-// void StartVisualTimer()
-//      Starts periodic visual updates (anchor refresh / client particle sync).
-//      Params: none
+// void OnVisualTick(PlayerBase player, vector playerPos, int nowMs)
+//      Visual update (cloud spawn / LOD / despawn, player-local particle), driven by TieredGasVisualManager.
+//      Params:
+//          player: local player
+//          playerPos: local player position
+//          nowMs: current game time (ms)
 //
-// void StopVisualTimer()
-//      Stops periodic visual updates.
-//      Params: none
+// void SetZonePosition(vector pos)
+//      Moves the zone object and re-resolves the cached ground height (only call site that samples terrain).
+//      Params:
+//          pos: new world position
 //
-// void OnVisualTick()
-//      Periodic visual update callback.
+// void RefreshGroundY()
+//      Samples terrain height at the zone center once and updates cached vertical bounds.
 //      Params: none
 //
 // bool IsInside(vector pos)
-//      Checks if a world position is inside the zone’s volume/radius.
+//      Checks if a world position is inside the zone’s volume/radius (uses cached ground height).
 //      Params:
 //          pos: world position
 //
@@ -74,6 +90,32 @@
 //      Returns computed anchor max for this zone (based on radius/density/advanced settings).
 //      Params: none
 //
+// int GetCloudDemand()
+//      Emitters this zone wants (anchor count of the last build, GetAnchorMax() before the first one).
+//      Params: none
+//
+// void SetCloudBudget(int slots)
+//      Emitter slots granted by TieredGasVisualManager's global allocation (-1 = unlimited).
+//      Params:
+//          slots: granted emitters
+//
+// void SetViewCulled(bool culled)
+//      Set by TieredGasVisualManager before each tick; a culled zone keeps its cloud state but its
+//      emitters are paused in TieredGasParticleManager.
+//      Params:
+//          culled: zone footprint is outside the camera view cone
+//
+// bool IsViewCulled()
+//      Current view-cull state.
+//      Params: none
+//
+// array<vector> SelectCloudAnchors(array<vector> anchors, vector playerPos)
+//      Picks the budgeted subset of anchors: nearest to the player first, anchors behind the camera
+//      ranked as if 1.5x further away.
+//      Params:
+//          anchors: full anchor layout
+//          playerPos: local player position
+//
 // float GetAnchorJitter()
 //      Returns computed jitter for this zone.
 //      Params: none
@@ -97,10 +139,27 @@
 //      Params:
 //          seed: seed value
 //
-// array<vector> BuildCloudAnchorsFilled(vector center)
-//      Builds anchor positions for cloud particles covering the zone area.
+// array<vector> GetCloudAnchors(int lod = 0)
+//      Cached anchor layout for the current config; built on first use and after InvalidateCloudAnchors().
+//      Levels are precomputed subsets of the same layout: 0 = every anchor, 1 = every 2nd ring point,
+//      2 = every 4th ring point (center always kept), so LOD switches only pick another cached array.
+//      Params:
+//          lod: anchor LOD level (0..CLOUD_LOD_LEVELS-1)
+//
+// int ResolveCloudLod(float dist)
+//      Anchor LOD level for a player distance, with CLOUD_HI_HYSTERESIS around each threshold.
+//      Params:
+//          dist: player distance to zone center
+//
+// void InvalidateCloudAnchors()
+//      Drops the cached layout (radius, density or position changed).
+//      Params: none
+//
+// array<vector> BuildCloudAnchorsFilled(vector center, array<int> outRingSlots)
+//      Builds anchor positions for cloud particles covering the zone area (one SurfaceY per anchor).
 //      Params:
 //          center: zone center position
+//          outRingSlots: per anchor, its index within its ring (-1 for the center)
 //
 // string GetUUID()
 //      Returns zone UUID.
@@ -147,6 +206,9 @@ class TG_AdvancedTieredGasSetting
     ref map<string, float> spacingByDensity;        
     ref map<string, float> jitterByDensity;         
     int maxAnchorsHardCap;
+    int maxCloudParticlesGlobal;
+    int cloudEmittersPerFrame;
+    int cloudEmitterPoolSize = -1;
 }
 
 class TG_AdvancedTieredGasSettingMgr
@@ -187,6 +249,9 @@ class TG_AdvancedTieredGasSettingMgr
         def.jitterByDensity.Insert("Dense", 10.0);
 
         def.maxAnchorsHardCap = 600;
+        def.maxCloudParticlesGlobal = 900;
+        def.cloudEmittersPerFrame = 24;
+        def.cloudEmitterPoolSize = 300;
 
         s_Data = TieredGasJSON.LoadAdvancedSettings(def);
 
@@ -240,6 +305,27 @@ class TG_AdvancedTieredGasSettingMgr
         if (outMax < 1) outMax = 1;
         return outMax;
     }
+
+    static int GetGlobalParticleBudget()
+    {
+        EnsureLoaded();
+        if (s_Data.maxCloudParticlesGlobal < 1) return 1;
+        return s_Data.maxCloudParticlesGlobal;
+    }
+
+    static int GetCloudEmittersPerFrame()
+    {
+        EnsureLoaded();
+        if (s_Data.cloudEmittersPerFrame < 1) return 1;
+        return s_Data.cloudEmittersPerFrame;
+    }
+
+    static int GetCloudEmitterPoolSize()
+    {
+        EnsureLoaded();
+        if (s_Data.cloudEmitterPoolSize < 0) return 0;
+        return s_Data.cloudEmitterPoolSize;
+    }
 }
 class TieredGasZone : BuildingBase
 {
@@ -248,6 +334,8 @@ class TieredGasZone : BuildingBase
     static const float CLOUD_DESPAWN_RANGE      = 2000.0;
     static const float CLOUD_DESPAWN_HOLD_SECONDS = 0;
     static const float CLOUD_HI_RANGE           = 600.0;
+    static const float CLOUD_FAR_RANGE          = 1100.0;
+    static const int   CLOUD_LOD_LEVELS         = 3;
     static const float CLOUD_HI_HYSTERESIS      = 25.0;
     static const int   CLOUD_LOD_COOLDOWN_MS    = 8000;
     static const float VISUAL_CHECK_SECONDS     = 0.25;
@@ -272,31 +360,64 @@ class TieredGasZone : BuildingBase
     bool m_IsDynamic;
     bool m_MaskRequired;
 
-    protected ref Timer m_VisualTimer;
+    protected float m_GroundY;
+    protected float m_BaseY;
+    protected bool m_GroundResolved;
+
     protected bool m_CloudActive;
-    protected bool m_LastCloudLow;
+    protected bool m_LocalOwned;
+    protected int m_LastVisualTickMs;
+
+    // TieredGasVisualManager bookkeeping: pass stamp (dedupes near candidates vs active zones), this
+    // zone's slots in its zone, active and work lists (-1 = not listed) so registration stays O(1), and
+    // the next time its distance tier is due.
+    int m_VisualPass;
+    int m_VisualSlot = -1;
+    int m_ActiveSlot = -1;
+    int m_WorkSlot = -1;
+    int m_NextVisualTickMs;
+
+    protected int m_CloudLod;
     protected string m_LastCloudKey;
 
     protected float m_DespawnOverTimer;
 
     protected int m_LastLodSwitchMs;
 
+    // Global particle budget: granted slots, emitters currently played, full layout size and the
+    // player position the played subset was selected for.
+    static const float CLOUD_RESELECT_DIST = 150.0;
+    protected int m_CloudBudget = -1;
+    protected int m_AppliedCount;
+    protected int m_AnchorCount;
+    protected vector m_SelectPos;
+
+    // View culling (TieredGasVisualManager): requested state and the state applied to the emitters.
+    protected bool m_ViewCulled;
+    protected bool m_CloudPaused;
+
+    // Anchor layout is deterministic per UUID/radius/density/position, so it is built once and kept,
+    // one array per LOD level.
+    protected ref array<ref array<vector>> m_AnchorLods;
+
     void TieredGasZone()
     {
         m_CloudActive = false;
-        m_LastCloudLow = false;
+        m_CloudLod = 0;
         m_LastCloudKey = "";
         m_DespawnOverTimer = 0.0;
         m_LastLodSwitchMs = 0;
+        m_LastVisualTickMs = 0;
+        m_LocalOwned = false;
         m_MaskRequired = false;
+        m_GroundResolved = false;
     }
 
     void ~TieredGasZone()
     {
-        StopVisualTimer();
-
         if (GetGame() && (GetGame().IsClient() || !GetGame().IsMultiplayer()))
         {
+            TieredGasVisualManager.Unregister(this);
             TieredGasParticleManager.RemoveZoneCloud(m_UUID, 0.0);
             TieredGasParticleManager.ClearPlayerLocalIfOwner(this);
         }
@@ -304,6 +425,8 @@ class TieredGasZone : BuildingBase
 
     void ApplyConfig(string uuid, string name, string colorId, string density, int tier, int gasType, float radius, bool maskRequired, float height, float bottomOffset, float verticalMargin, bool isDynamic)
     {
+        if (uuid != m_UUID || density != m_Density || radius != m_Radius) InvalidateCloudAnchors();
+
         m_UUID = uuid;
         m_Name = name;
         m_ColorId = colorId;
@@ -318,37 +441,39 @@ class TieredGasZone : BuildingBase
         m_VerticalMargin = verticalMargin;
         m_IsDynamic = isDynamic;
 
-        StartVisualTimer();
-    }
-
-    protected void StartVisualTimer()
-    {
-        if (!GetGame() || !(GetGame().IsClient() || !GetGame().IsMultiplayer())) { return; }
+        if (!m_GroundResolved) { RefreshGroundY(); }
+        m_BaseY = m_GroundY - m_BottomOffset;
 
-        if (!m_VisualTimer)
+        if (GetGame() && (GetGame().IsClient() || !GetGame().IsMultiplayer()))
         {
-            m_VisualTimer = new Timer(CALL_CATEGORY_GAMEPLAY);
-            m_VisualTimer.Run(VISUAL_CHECK_SECONDS, this, "OnVisualTick", NULL, true);
+            TieredGasVisualManager.Register(this);
         }
     }
 
-    protected void StopVisualTimer()
+    void SetZonePosition(vector pos)
     {
-        if (m_VisualTimer)
-        {
-            m_VisualTimer.Stop();
-            m_VisualTimer = null;
-        }
+        vector cur = GetPosition();
+        SetPosition(pos);
+
+        if (m_GroundResolved && cur[0] == pos[0] && cur[2] == pos[2]) { return; }
+        InvalidateCloudAnchors();
+        RefreshGroundY();
     }
 
-    void OnVisualTick()
+    void RefreshGroundY()
     {
-        if (!GetGame() || !(GetGame().IsClient() || !GetGame().IsMultiplayer())) { return; }
+        vector c = GetPosition();
+        m_GroundY = GetGame().SurfaceY(c[0], c[2]);
+        m_BaseY = m_GroundY - m_BottomOffset;
+        m_GroundResolved = true;
+    }
 
-        PlayerBase player = PlayerBase.Cast(GetGame().GetPlayer());
-        if (!player) { return; }
+    void OnVisualTick(PlayerBase player, vector playerPos, int nowMs)
+    {
+        float elapsed = VISUAL_CHECK_SECONDS;
+        if (m_LastVisualTickMs > 0) elapsed = (nowMs - m_LastVisualTickMs) / 1000.0;
+        m_LastVisualTickMs = nowMs;
 
-        vector playerPos = player.GetPosition();
         vector zonePos = GetPosition();
 
         float distSq = vector.DistanceSq(playerPos, zonePos);
@@ -364,7 +489,7 @@ class TieredGasZone : BuildingBase
 
         if (m_CloudActive && !shouldKeepCloud)
         {
-            m_DespawnOverTimer += VISUAL_CHECK_SECONDS;
+            m_DespawnOverTimer += elapsed;
             if (m_DespawnOverTimer >= CLOUD_DESPAWN_HOLD_SECONDS)
             {
                 m_CloudActive = false;
@@ -378,73 +503,155 @@ class TieredGasZone : BuildingBase
             m_DespawnOverTimer = 0.0;
         }
 
-        if (shouldSpawnCloud || shouldKeepCloud)
+        // No slots left in the global budget: drop the cloud and don't build anchors for nothing.
+        if (m_CloudBudget == 0)
         {
-            bool useLow = false;
-
-            float hiIn  = (CLOUD_HI_RANGE - CLOUD_HI_HYSTERESIS);
-            float hiOut = (CLOUD_HI_RANGE + CLOUD_HI_HYSTERESIS);
-
-            int nowMs = GetGame().GetTime();
-
-            bool desiredLow = false;
-            if (m_LastCloudLow)
-            {
-                if (dist > hiIn) desiredLow = true;
-            }
-            else
+            if (m_CloudActive)
             {
-                if (dist > hiOut) desiredLow = true;
+                m_CloudActive = false;
+                m_LastCloudKey = "";
+                m_AppliedCount = 0;
+                TieredGasParticleManager.RemoveZoneCloud(m_UUID, CLOUD_CROSSFADE_SECONDS);
             }
+            shouldSpawnCloud = false;
+            shouldKeepCloud = false;
+        }
 
-            useLow = m_LastCloudLow;
-            if (desiredLow != m_LastCloudLow)
+        if (shouldSpawnCloud || shouldKeepCloud)
+        {
+            int lod = m_CloudLod;
+            int desiredLod = ResolveCloudLod(dist);
+            if (desiredLod != m_CloudLod)
             {
                 if ((nowMs - m_LastLodSwitchMs) >= CLOUD_LOD_COOLDOWN_MS)
                 {
-                    useLow = desiredLow;
+                    lod = desiredLod;
                     m_LastLodSwitchMs = nowMs;
                 }
             }
 
-            string cloudKey = ResolveCloudParticleKey(useLow);
+            // No larger far-field assets exist, so every decimated level plays the _low variant.
+            string cloudKey = ResolveCloudParticleKey(lod > 0);
 
-            if (m_CloudActive && m_LastCloudKey == cloudKey && m_LastCloudLow == useLow)
-            {
+            bool rebuild = !(m_CloudActive && m_LastCloudKey == cloudKey && m_CloudLod == lod);
+            if (!rebuild && CloudBudgetChanged(playerPos)) rebuild = true;
 
-            }
-            else
+            if (rebuild)
             {
-                ref array<vector> anchors = BuildCloudAnchorsFilled(zonePos);
+                array<vector> anchors = GetCloudAnchors(lod);
+                m_AnchorCount = anchors.Count();
 
-                TieredGasParticleManager.UpdateZoneCloud(m_UUID, anchors, cloudKey, CLOUD_CROSSFADE_SECONDS);
+                array<vector> chosen = SelectCloudAnchors(anchors, playerPos);
+
+                TieredGasParticleManager.UpdateZoneCloud(m_UUID, chosen, cloudKey, CLOUD_CROSSFADE_SECONDS, true);
                 m_CloudActive = true;
-                m_LastCloudLow = useLow;
+                m_CloudLod = lod;
                 m_LastCloudKey = cloudKey;
+                m_AppliedCount = chosen.Count();
+                m_SelectPos = playerPos;
+                m_CloudPaused = false;
             }
         }
 
+        if (m_CloudActive && m_CloudPaused != m_ViewCulled)
+        {
+            TieredGasParticleManager.SetZoneCloudPaused(m_UUID, m_ViewCulled);
+            m_CloudPaused = m_ViewCulled;
+        }
+
         if (inside)
         {
             string localKey = ResolveLocalParticleKey();
             TieredGasParticleManager.UpdatePlayerLocalFromZone(this, m_GasTier, player, localKey);
+            m_LocalOwned = true;
         }
-        else
+        else if (m_LocalOwned)
         {
             TieredGasParticleManager.ClearPlayerLocalIfOwner(this);
+            m_LocalOwned = false;
         }
+
+        TieredGasVisualManager.SetActive(this, m_CloudActive || m_LocalOwned);
+    }
+
+    int GetCloudDemand()
+    {
+        if (m_AnchorCount > 0) return m_AnchorCount;
+        return GetAnchorMax() + 1;
+    }
+
+    void SetViewCulled(bool culled)
+    {
+        m_ViewCulled = culled;
+    }
+
+    bool IsViewCulled()
+    {
+        return m_ViewCulled;
+    }
+
+    void SetCloudBudget(int slots)
+    {
+        m_CloudBudget = slots;
+    }
+
+    protected bool CloudBudgetChanged(vector playerPos)
+    {
+        int want = m_AnchorCount;
+        if (m_CloudBudget >= 0 && m_CloudBudget < want) want = m_CloudBudget;
+
+        // Ignore small swings so the allocation does not rebuild clouds every pass.
+        int tolerance = m_AppliedCount / 10;
+        if (tolerance < 8) tolerance = 8;
+        if (want == m_AnchorCount && m_AppliedCount != m_AnchorCount) return true;
+        if (Math.AbsInt(want - m_AppliedCount) > tolerance) return true;
+
+        // A partial subset follows the player through large zones.
+        if (m_AppliedCount < m_AnchorCount && vector.DistanceSq(playerPos, m_SelectPos) > (CLOUD_RESELECT_DIST * CLOUD_RESELECT_DIST)) return true;
+
+        return false;
+    }
+
+    array<vector> SelectCloudAnchors(array<vector> anchors, vector playerPos)
+    {
+        int count = anchors.Count();
+        if (m_CloudBudget < 0 || m_CloudBudget >= count) return anchors;
+
+        vector camPos = GetGame().GetCurrentCameraPosition();
+        vector camDir = GetGame().GetCurrentCameraDirection();
+
+        // key = rank distance (m) << 12 | anchor index (anchors are capped well below 4096)
+        array<int> keys = new array<int>;
+        for (int i = 0; i < count; i++)
+        {
+            vector a = anchors[i];
+            float d = vector.Distance(playerPos, a);
+            if (vector.Dot(a - camPos, camDir) < 0) d *= 1.5;
+
+            int rank = d;
+            keys.Insert((rank << 12) | i);
+        }
+        keys.Sort();
+
+        array<vector> chosen = new array<vector>;
+        for (int k = 0; k < m_CloudBudget; k++)
+        {
+            chosen.Insert(anchors[keys[k] & 0xFFF]);
+        }
+        return chosen;
     }
 
     bool IsInside(vector pos)
     {
+        if (!m_GroundResolved) { RefreshGroundY(); }
+
         vector z = GetPosition();
-        z[1] = GetGame().SurfaceY(z[0], z[2]) - m_BottomOffset;
 
         float dx = pos[0] - z[0];
         float dz = pos[2] - z[2];
         float hDist = Math.Sqrt((dx * dx) + (dz * dz));
 
-        float dy = pos[1] - z[1];
+        float dy = pos[1] - m_BaseY;
 
         if (hDist > m_Radius) return false;
         if (dy < 0) return false;
@@ -523,9 +730,11 @@ class TieredGasZone : BuildingBase
         string color = NormalizeColor(m_ColorId);
         string dens  = NormalizeDensity(m_Density);
 
-        Print("LocalPlayer Key: "+"TieredGasLocal_" + color + "_" + dens);
+        string key = "TieredGasLocal_" + color + "_" + dens;
+        if (TieredGasLog.IsEnabled(TieredGasLogLevel.TRACE))
+            TieredGasLog.LogTrace("[TieredGas] LocalPlayer Key: " + key);
 
-        return "TieredGasLocal_" + color + "_" + dens;
+        return key;
     }
 
     protected int HashString(string s)
@@ -546,10 +755,59 @@ class TieredGasZone : BuildingBase
         return (v / 32767.0);
     }
 
-    protected ref array<vector> BuildCloudAnchorsFilled(vector center)
+    int ResolveCloudLod(float dist)
+    {
+        float hiRange = CLOUD_HI_RANGE + CLOUD_HI_HYSTERESIS;
+        if (m_CloudLod >= 1) hiRange = CLOUD_HI_RANGE - CLOUD_HI_HYSTERESIS;
+
+        float farRange = CLOUD_FAR_RANGE + CLOUD_HI_HYSTERESIS;
+        if (m_CloudLod >= 2) farRange = CLOUD_FAR_RANGE - CLOUD_HI_HYSTERESIS;
+
+        if (dist > farRange) return 2;
+        if (dist > hiRange) return 1;
+        return 0;
+    }
+
+    array<vector> GetCloudAnchors(int lod = 0)
+    {
+        if (!m_AnchorLods)
+        {
+            array<int> slots = new array<int>;
+            array<vector> full = BuildCloudAnchorsFilled(GetPosition(), slots);
+
+            m_AnchorLods = new array<ref array<vector>>;
+            m_AnchorLods.Insert(full);
+
+            for (int level = 1; level < CLOUD_LOD_LEVELS; level++)
+            {
+                int stride = 1 << level;
+                array<vector> sub = new array<vector>;
+                for (int i = 0; i < full.Count(); i++)
+                {
+                    if (slots[i] < 0 || (slots[i] % stride) == 0) sub.Insert(full[i]);
+                }
+                m_AnchorLods.Insert(sub);
+            }
+        }
+
+        if (lod < 0) lod = 0;
+        if (lod >= CLOUD_LOD_LEVELS) lod = CLOUD_LOD_LEVELS - 1;
+        return m_AnchorLods[lod];
+    }
+
+    void InvalidateCloudAnchors()
+    {
+        m_AnchorLods = null;
+
+        // Force the next visual tick to rebuild a live cloud on the new layout.
+        m_LastCloudKey = "";
+    }
+
+    protected ref array<vector> BuildCloudAnchorsFilled(vector center, notnull array<int> outRingSlots)
     {
         ref array<vector> anchors = new array<vector>();
         anchors.Insert(center);
+        outRingSlots.Insert(-1);
 
         float r = m_Radius;
 
@@ -581,6 +839,7 @@ class TieredGasZone : BuildingBase
                 float ay = GetGame().SurfaceY(ax, az);
 
                 anchors.Insert(Vector(ax, ay, az));
+                outRingSlots.Insert(i);
             }
 
             ringR += ringStep;
@@ -99,6 +99,11 @@
 //      Stops preview particles.
 //      Params: none
 //
+// void RefreshParticlesList()
+//      Lists the registered particle keys, headed by the cloud emitter pool counters (hits / misses / idle)
+//      used to size cloudEmitterPoolSize.
+//      Params: none
+//
 // bool OnClick(Widget w, int x, int y, int button)
 //      Handles button clicks.
 //      Params: standard UI click args
@@ -364,11 +369,11 @@ class TieredGasAdminMenu : ScriptedWidgetEventHandler
 
     void UpdateZonesList(array<ref GasZoneConfig> zones)
     {
-        Print("[TieredGasAdminMenu] UpdateZonesList START");
+        TieredGasLog.LogDebug("[TieredGasAdminMenu] UpdateZonesList START");
 
         if (!m_IsOpen || !m_Root || !m_ListZones)
         {
-            Print("[TieredGasAdminMenu] Menu or widgets not ready");
+            TieredGasLog.LogWarn("[TieredGasAdminMenu] Menu or widgets not ready");
             return;
         }
 
@@ -380,7 +385,7 @@ class TieredGasAdminMenu : ScriptedWidgetEventHandler
 
         if (!zones)
         {
-            Print("[TieredGasAdminMenu] Zones array NULL");
+            TieredGasLog.LogDebug("[TieredGasAdminMenu] Zones array NULL");
             return;
         }
         for (int i = 0; i < zones.Count(); i++)
@@ -388,7 +393,8 @@ class TieredGasAdminMenu : ScriptedWidgetEventHandler
             GasZoneConfig z = zones[i];
             if (!z)
             {
-                Print("[TieredGasAdminMenu] Zone[" + i + "] NULL");
+                if (TieredGasLog.IsEnabled(TieredGasLogLevel.DEBUG))
+                    TieredGasLog.LogDebug("[TieredGasAdminMenu] Zone[" + i + "] NULL");
                 continue;
             }
 
@@ -399,7 +405,7 @@ class TieredGasAdminMenu : ScriptedWidgetEventHandler
                 m_ZoneUuids.Insert(z.uuid);
         }
         SetStatus("Done!", false);
-        Print("[TieredGasAdminMenu] UpdateZonesList END");
+        TieredGasLog.LogDebug("[TieredGasAdminMenu] UpdateZonesList END");
     }
 
     void RefreshZonesFromClientCache()
@@ -927,6 +933,12 @@ class TieredGasAdminMenu : ScriptedWidgetEventHandler
 
         m_ListParticles.ClearItems();
 
+        int poolHits;
+        int poolMisses;
+        int poolIdle;
+        TieredGasParticleManager.GetPoolStats(poolHits, poolMisses, poolIdle);
+        m_ListParticles.AddItem(string.Format("Emitter pool | hits %1 | misses %2 | idle %3", poolHits, poolMisses, poolIdle), null, 0);
+
         if (TieredGasParticleManager.m_ParticleIdCache)
         {
             foreach (string k, int id : TieredGasParticleManager.m_ParticleIdCache)
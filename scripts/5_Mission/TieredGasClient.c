@@ -18,7 +18,8 @@
 //      Params: none
 //
 // void OnUpdate(float timeslice)
-//      Per-frame tick: updates HUD/admin menu state and handles delayed closes.
+//      Per-frame tick: updates HUD/admin menu state, handles delayed closes and drives TieredGasVisualManager
+//      and the particle manager's spawn/stop queues (offline: also drives the server gas scheduler).
 //      Params:
 //          timeslice: frame delta time
 //
@@ -101,6 +102,7 @@ modded class MissionGameplay
         if (GetGame().IsClient() || !GetGame().IsMultiplayer())
         {
             TieredGasParticleManager.Init();
+            TieredGasParticleManager.SetPoolMax(TG_AdvancedTieredGasSettingMgr.GetCloudEmitterPoolSize());
         }
     }
 
@@ -127,6 +129,12 @@ modded class MissionGameplay
     {
         super.OnUpdate(timeslice);
 
+        // Offline / listen: this mission is also the server, so it drives the gas scheduler.
+        if (GetGame().IsServer())
+        {
+            TieredGasServerScheduler.OnUpdate(timeslice);
+        }
+
         if (!GetGame().IsClient() && GetGame().IsMultiplayer())
         {
             return;
@@ -135,12 +143,20 @@ modded class MissionGameplay
         HandleAdminHotkeys();
         UpdateAdminControlLock();
 
+        TieredGasVisualManager.OnUpdate(timeslice);
+        TieredGasParticleManager.OnUpdate(TG_AdvancedTieredGasSettingMgr.GetCloudEmittersPerFrame());
+
         if (!m_ZonesRequested)
         {
             PlayerBase p0 = PlayerBase.Cast(GetGame().GetPlayer());
             if (p0 && p0.GetIdentity())
             {
-                GetGame().RPCSingleParam(p0, RPC_TIERED_GAS_ZONES_REQUEST, null, true, p0.GetIdentity());
+                // Offer the hash of our cached zone set; the server skips the transfer if it still matches.
+                int cachedHash;
+                if (TieredGasZoneCache.GetHash(cachedHash))
+                    GetGame().RPCSingleParam(p0, RPC_TIERED_GAS_ZONES_REQUEST, new Param1<int>(cachedHash), true, p0.GetIdentity());
+                else
+                    GetGame().RPCSingleParam(p0, RPC_TIERED_GAS_ZONES_REQUEST, null, true, p0.GetIdentity());
                 m_ZonesRequested = true;
             }
         }
@@ -385,6 +401,16 @@ modded class MissionGameplay
             }
             return;
         }
+
+        if (inp.LocalPress("UATG_BenchmarkGasZones"))
+        {
+            if (EnsureAdminCached(false))
+            {
+                Print("[TieredGasMod][Input] Benchmark Zone Queries");
+                GetGame().RPCSingleParam(p, RPC_ADMIN_BENCHMARK_ZONES, null, true, p.GetIdentity());
+            }
+            return;
+        }
     }
 
     void ToggleAdminMenu()
@@ -450,7 +476,15 @@ modded class MissionGameplay
 
         if (GetGame().IsClient() || !GetGame().IsMultiplayer())
         {
+            TieredGasVisualManager.Cleanup();
             TieredGasParticleManager.Cleanup();
+            TieredGasZoneCache.Cleanup();
+        }
+
+        if (GetGame().IsServer())
+        {
+            TieredGasServerScheduler.Cleanup();
+            TieredGasOccupancy.Cleanup();
         }
 
         if (m_GasHUD)
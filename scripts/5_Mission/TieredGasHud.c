@@ -35,9 +35,9 @@ class TieredGasHUD
 
     void TieredGasHUD()
     {
-        Print("==============================================");
-        Print("[TieredGasMod] Gas HUD Constructor Called");
-        Print("==============================================");
+        TieredGasLog.LogDebug("==============================================");
+        TieredGasLog.LogDebug("[TieredGasMod] Gas HUD Constructor Called");
+        TieredGasLog.LogDebug("==============================================");
         m_IconPaths = new map<string, string>;
         m_IconPaths.Insert("TOXIC_1", "TieredGasMod/mod_icons/toxic_t1.paa");
         m_IconPaths.Insert("TOXIC_2", "TieredGasMod/mod_icons/toxic_t2.paa");
@@ -54,52 +54,55 @@ class TieredGasHUD
         m_IconPaths.Insert("BIO_3", "TieredGasMod/mod_icons/bio_t3.paa");
         m_IconPaths.Insert("BIO_4", "TieredGasMod/mod_icons/bio_t4.paa");
 
-        Print("[TieredGasMod] Icon paths registered: " + m_IconPaths.Count() + " entries");
-        Print("[TieredGasMod] HUD Constructor complete - widgets will be created on demand");
+        if (TieredGasLog.IsEnabled(TieredGasLogLevel.DEBUG))
+            TieredGasLog.LogDebug("[TieredGasMod] Icon paths registered: " + m_IconPaths.Count() + " entries");
+        TieredGasLog.LogDebug("[TieredGasMod] HUD Constructor complete - widgets will be created on demand");
     }
 
     bool CreateWidgets()
     {
         if (m_WidgetsCreated)
         {
-            Print("[TieredGasMod] Widgets already created, skipping");
+            TieredGasLog.LogDebug("[TieredGasMod] Widgets already created, skipping");
             return true;
         }
 
-        Print("[TieredGasMod] CreateWidgets() called");
+        TieredGasLog.LogDebug("[TieredGasMod] CreateWidgets() called");
         
         if (!GetGame())
         {
-            Print("[TieredGasMod] ERROR: GetGame() returned null!");
+            TieredGasLog.LogError("[TieredGasMod] ERROR: GetGame() returned null!");
             return false;
         }
         
         WorkspaceWidget workspace = GetGame().GetWorkspace();
         if (!workspace)
         {
-            Print("[TieredGasMod] ERROR: GetWorkspace() returned null!");
+            TieredGasLog.LogError("[TieredGasMod] ERROR: GetWorkspace() returned null!");
             return false;
         }
         
         if (!GetGame().GetMission())
         {
-            Print("[TieredGasMod] ERROR: GetMission() returned null!");
+            TieredGasLog.LogError("[TieredGasMod] ERROR: GetMission() returned null!");
             return false;
         }
 
-        Print("[TieredGasMod] Attempting to load HUD layout from: TieredGasMod/GUI/layouts/TieredGas/HUD.layout");
+        TieredGasLog.LogDebug("[TieredGasMod] Attempting to load HUD layout from: TieredGasMod/GUI/layouts/TieredGas/HUD.layout");
         
         m_RootWidget = workspace.CreateWidgets("TieredGasMod/GUI/layouts/TieredGas/HUD.layout");
         
         if (!m_RootWidget)
         {
-            Print("[TieredGasMod] ERROR: Failed to create root widget! Check if layout file exists.");
+            TieredGasLog.LogError("[TieredGasMod] ERROR: Failed to create root widget! Check if layout file exists.");
             return false;
         }
         
-        Print("[TieredGasMod] SUCCESS: Root widget created");
-        Print("[TieredGasMod] Root widget name: " + m_RootWidget.GetName());
-        Print("[TieredGasMod] Root widget visible: " + m_RootWidget.IsVisible());
+        TieredGasLog.LogDebug("[TieredGasMod] SUCCESS: Root widget created");
+        if (TieredGasLog.IsEnabled(TieredGasLogLevel.DEBUG))
+            TieredGasLog.LogDebug("[TieredGasMod] Root widget name: " + m_RootWidget.GetName());
+        if (TieredGasLog.IsEnabled(TieredGasLogLevel.DEBUG))
+            TieredGasLog.LogDebug("[TieredGasMod] Root widget visible: " + m_RootWidget.IsVisible());
 
         m_RootWidget.Show(true);
         
@@ -107,17 +110,18 @@ class TieredGasHUD
         
         if (!m_IconWidget)
         {
-            Print("[TieredGasMod] ERROR: Failed to find 'GasIcon' widget in layout!");
-            Print("[TieredGasMod] Trying to list all child widgets...");
+            TieredGasLog.LogError("[TieredGasMod] ERROR: Failed to find 'GasIcon' widget in layout!");
+            TieredGasLog.LogDebug("[TieredGasMod] Trying to list all child widgets...");
 
             Widget child = m_RootWidget.GetChildren();
             if (child)
             {
-                Print("[TieredGasMod] Found child widget: " + child.GetName());
+                if (TieredGasLog.IsEnabled(TieredGasLogLevel.DEBUG))
+                    TieredGasLog.LogDebug("[TieredGasMod] Found child widget: " + child.GetName());
             }
             else
             {
-                Print("[TieredGasMod] No child widgets found!");
+                TieredGasLog.LogDebug("[TieredGasMod] No child widgets found!");
             }
 
             if (m_RootWidget)
@@ -129,22 +133,26 @@ class TieredGasHUD
             return false;
         }
         
-        Print("[TieredGasMod] SUCCESS: Icon widget found");
-        Print("[TieredGasMod] Icon widget name: " + m_IconWidget.GetName());
-        Print("[TieredGasMod] Icon widget visible: " + m_IconWidget.IsVisible());
+        TieredGasLog.LogDebug("[TieredGasMod] SUCCESS: Icon widget found");
+        if (TieredGasLog.IsEnabled(TieredGasLogLevel.DEBUG))
+            TieredGasLog.LogDebug("[TieredGasMod] Icon widget name: " + m_IconWidget.GetName());
+        if (TieredGasLog.IsEnabled(TieredGasLogLevel.DEBUG))
+            TieredGasLog.LogDebug("[TieredGasMod] Icon widget visible: " + m_IconWidget.IsVisible());
 
         float x, y;
         m_IconWidget.GetScreenPos(x, y);
-        Print("[TieredGasMod] Icon widget screen position: X=" + x + " Y=" + y);
+        if (TieredGasLog.IsEnabled(TieredGasLogLevel.DEBUG))
+            TieredGasLog.LogDebug("[TieredGasMod] Icon widget screen position: X=" + x + " Y=" + y);
         
         float w, h;
         m_IconWidget.GetScreenSize(w, h);
-        Print("[TieredGasMod] Icon widget screen size: W=" + w + " H=" + h);
+        if (TieredGasLog.IsEnabled(TieredGasLogLevel.DEBUG))
+            TieredGasLog.LogDebug("[TieredGasMod] Icon widget screen size: W=" + w + " H=" + h);
 
         m_IconWidget.Show(false);
         
         m_WidgetsCreated = true;
-        Print("[TieredGasMod] Widget creation complete - HUD is ready");
+        TieredGasLog.LogDebug("[TieredGasMod] Widget creation complete - HUD is ready");
         
         return true;
     }
@@ -153,17 +161,17 @@ class TieredGasHUD
     {
         if (!m_WidgetsCreated)
         {
-            Print("[TieredGasMod] Widgets not created yet, attempting to create...");
+            TieredGasLog.LogDebug("[TieredGasMod] Widgets not created yet, attempting to create...");
             if (!CreateWidgets())
             {
-                Print("[TieredGasMod] Failed to create widgets, cannot show HUD");
+                TieredGasLog.LogError("[TieredGasMod] Failed to create widgets, cannot show HUD");
                 return;
             }
         }
         
         if (!m_IconWidget)
         {
-            Print("[TieredGasMod] ERROR: Cannot show HUD - Icon widget is null!");
+            TieredGasLog.LogError("[TieredGasMod] ERROR: Cannot show HUD - Icon widget is null!");
             return;
         }
 
@@ -172,20 +180,23 @@ class TieredGasHUD
             return;
         }
 
-        Print("[TieredGasMod] Show() called - Type: " + gasType + " Tier: " + tier);
+        if (TieredGasLog.IsEnabled(TieredGasLogLevel.DEBUG))
+            TieredGasLog.LogDebug("[TieredGasMod] Show() called - Type: " + gasType + " Tier: " + tier);
 
         string key = gasType + "_" + tier;
-        Print("[TieredGasMod] Looking for icon with key: '" + key + "'");
+        if (TieredGasLog.IsEnabled(TieredGasLogLevel.DEBUG))
+            TieredGasLog.LogDebug("[TieredGasMod] Looking for icon with key: '" + key + "'");
         
         string iconPath = m_IconPaths.Get(key);
 
         if (!iconPath || iconPath == "")
         {
-            Print("[TieredGasMod] ERROR: No icon path found for key: " + key);
+            TieredGasLog.LogError("[TieredGasMod] ERROR: No icon path found for key: " + key);
             return;
         }
 
-        Print("[TieredGasMod] Loading icon from path: " + iconPath);
+        if (TieredGasLog.IsEnabled(TieredGasLogLevel.DEBUG))
+            TieredGasLog.LogDebug("[TieredGasMod] Loading icon from path: " + iconPath);
 
         m_IconWidget.LoadImageFile(0, iconPath);
         float w, h;
@@ -195,13 +206,13 @@ class TieredGasHUD
  
         m_IconWidget.SetColor(ARGB(255, 255, 255, 255));
         
-        Print("[TieredGasMod] Image loaded and displayed");
+        TieredGasLog.LogDebug("[TieredGasMod] Image loaded and displayed");
 
         m_LastGasType = gasType;
         m_LastTier = tier;
         m_IsShowing = true;
         
-        Print("[TieredGasMod] SUCCESS: HUD icon displayed!");
+        TieredGasLog.LogDebug("[TieredGasMod] SUCCESS: HUD icon displayed!");
     }
 
     void Hide()
@@ -216,7 +227,7 @@ class TieredGasHUD
             return; 
         }
         
-        Print("[TieredGasMod] Hide() called");
+        TieredGasLog.LogDebug("[TieredGasMod] Hide() called");
         
         m_IconWidget.Show(false);
 
@@ -224,19 +235,19 @@ class TieredGasHUD
         m_LastTier = 0;
         m_IsShowing = false;
         
-        Print("[TieredGasMod] HUD hidden");
+        TieredGasLog.LogDebug("[TieredGasMod] HUD hidden");
     }
 
     void ~TieredGasHUD()
     {
-        Print("[TieredGasMod] Gas HUD Destructor called");
+        TieredGasLog.LogDebug("[TieredGasMod] Gas HUD Destructor called");
         
         if (m_RootWidget)
         {
             m_RootWidget.Unlink();
-            Print("[TieredGasMod] Root widget unlinked");
+            TieredGasLog.LogDebug("[TieredGasMod] Root widget unlinked");
         }
         
-        Print("[TieredGasMod] Gas HUD destroyed");
+        TieredGasLog.LogDebug("[TieredGasMod] Gas HUD destroyed");
     }
 };
\ No newline at end of file
@@ -9,6 +9,11 @@
 //      Server init: creates profile folder if missing; triggers zone spawner init.
 //      Params: none
 //
+// void OnUpdate(float timeslice)
+//      Drives TieredGasServerScheduler and the zone sync send queue once per server frame.
+//      Params:
+//          timeslice: frame delta time
+//
 // void OnMissionFinish()
 //      Cleanup when mission ends (stop timers/cleanup server state).
 //      Params: none
@@ -35,15 +40,25 @@ modded class MissionServer
         TieredGasAdminMenuSettings.Load();
         TieredGasJSON.Load();
         TieredGasZoneSpawner.Init();
+        TieredGasServerScheduler.Init();
 
         Print("==============================================");
         Print("[TieredGasMod] Initialization Complete");
         Print("==============================================");
     }
 
+    override void OnUpdate(float timeslice)
+    {
+        super.OnUpdate(timeslice);
+        TieredGasServerScheduler.OnUpdate(timeslice);
+        TieredGasZoneSpawner.OnUpdate(timeslice);
+    }
+
     override void OnMissionFinish()
     {
         Print("[TieredGasMod] Server shutting down...");
+        TieredGasServerScheduler.Cleanup();
+        TieredGasOccupancy.Cleanup();
         TieredGasZoneSpawner.Cleanup();
         Print("[TieredGasMod] Cleanup complete");
         super.OnMissionFinish();